@@ -0,0 +1,923 @@
+// Microbenchmarks for the core GUI hot paths.
+//
+// Runs headless on the NullRenderer.  Each case reports the time per operation
+// and the number of heap allocations per operation; every case is run three
+// times and the fastest run is reported, so results are comparable between
+// builds.
+//
+// This file only builds against a full CEGUI 0.7 checkout.  The cegui/
+// directory of this tree is a partial snapshot that lacks, among others,
+// CEGUIRenderTarget.h, CEGUIRenderingRoot.h, CEGUIRenderingSurface.h,
+// CEGUIRenderingWindow.h, CEGUITextureTarget.h, CEGUIRenderEffect.h,
+// CEGUIImageCodec.h, CEGUIWindowRenderer.h, CEGUIFontManager.h,
+// CEGUIDefaultResourceProvider.h and CEGUIcolour.cpp, and whose
+// CEGUIFont.cpp and CEGUIXMLParser.h are empty; so neither it nor the
+// library builds from this tree alone.  Against a full checkout, build it
+// together with the library sources, the Null renderer module and an XML
+// parser module (needed by the loadWindowLayout case).
+//
+// Allocations are counted by replacing the global operator new, so they only
+// include allocations made by code linked into the executable; link CEGUI
+// statically to have its allocations counted.
+//
+// Usage: CoreBenchmark [filter]
+//     Only cases whose name contains filter are run.
+
+#include "../cegui/CEGUISystem.h"
+#include "../cegui/CEGUIClock.h"
+#include "../cegui/CEGUIWindowManager.h"
+#include "../cegui/CEGUIWindow.h"
+#include "../cegui/CEGUIGlobalEventSet.h"
+#include "../cegui/CEGUIImagesetManager.h"
+#include "../cegui/CEGUIImageset.h"
+#include "../cegui/CEGUIPixmapFont.h"
+#include "../cegui/CEGUIScriptModule.h"
+#include "../cegui/RendererModules/Null/CEGUINullRenderer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <new>
+#include <vector>
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+// allocation counting
+//----------------------------------------------------------------------------//
+#if __cplusplus >= 201103L
+#   define BENCHMARK_THROW_BAD_ALLOC
+#   define BENCHMARK_NOTHROW noexcept
+#else
+#   define BENCHMARK_THROW_BAD_ALLOC throw(std::bad_alloc)
+#   define BENCHMARK_NOTHROW throw()
+#endif
+
+static size_t s_allocations = 0;
+
+void* operator new(size_t size) BENCHMARK_THROW_BAD_ALLOC
+{
+    ++s_allocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) BENCHMARK_THROW_BAD_ALLOC
+{
+    ++s_allocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) BENCHMARK_NOTHROW
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) BENCHMARK_NOTHROW
+{
+    std::free(p);
+}
+
+namespace
+{
+//----------------------------------------------------------------------------//
+// return a window name that is unique within a benchmark run.
+String makeName(const char* prefix, uint index)
+{
+    char buff[64];
+    std::sprintf(buff, "%s%u", prefix, index);
+    return String(buff);
+}
+
+//----------------------------------------------------------------------------//
+Window* createChild(Window* parent, const String& name)
+{
+    Window* wnd = WindowManager::getSingleton().createWindow("DefaultWindow",
+                                                             name);
+    if (parent)
+        parent->addChildWindow(wnd);
+
+    return wnd;
+}
+
+//----------------------------------------------------------------------------//
+void destroyTree(Window* root)
+{
+    WindowManager::getSingleton().destroyWindow(root);
+    WindowManager::getSingleton().cleanDeadPool();
+}
+
+//----------------------------------------------------------------------------//
+// A benchmark case is a class that sets up its state in the constructor,
+// performs d_ops operations in run() - which is the only part timed - and
+// cleans up in the destructor.
+//----------------------------------------------------------------------------//
+class CreateWindowCase
+{
+public:
+    CreateWindowCase(uint ops) : d_ops(ops) { d_windows.reserve(ops); }
+
+    ~CreateWindowCase()
+    {
+        for (size_t i = 0; i < d_windows.size(); ++i)
+            WindowManager::getSingleton().destroyWindow(d_windows[i]);
+        WindowManager::getSingleton().cleanDeadPool();
+    }
+
+    void run()
+    {
+        WindowManager& wm = WindowManager::getSingleton();
+        for (uint i = 0; i < d_ops; ++i)
+            d_windows.push_back(wm.createWindow("DefaultWindow",
+                                                makeName("create", i)));
+    }
+
+private:
+    const uint d_ops;
+    std::vector<Window*> d_windows;
+};
+
+//----------------------------------------------------------------------------//
+// loads a layout of one root with 16 children, each with 4 children.
+class LoadLayoutCase
+{
+public:
+    static const char* const LayoutFile;
+
+    LoadLayoutCase(uint ops) : d_ops(ops)
+    {
+        d_roots.reserve(ops);
+
+        std::ofstream out(LayoutFile);
+        out << "<?xml version=\"1.0\" ?>\n<GUILayout>\n"
+               "<Window Type=\"DefaultWindow\" Name=\"Root\">\n"
+               "<Property Name=\"UnifiedAreaRect\" "
+               "Value=\"{{0,0},{0,0},{1,0},{1,0}}\" />\n";
+
+        for (int i = 0; i < 16; ++i)
+        {
+            out << "<Window Type=\"DefaultWindow\" Name=\"Root/Panel" << i
+                << "\">\n<Property Name=\"UnifiedAreaRect\" "
+                   "Value=\"{{0,0},{0.05,0},{0.5,0},{0.1,0}}\" />\n";
+
+            for (int j = 0; j < 4; ++j)
+                out << "<Window Type=\"DefaultWindow\" Name=\"Root/Panel" << i
+                    << "/Item" << j << "\">\n<Property Name=\"Text\" "
+                       "Value=\"Item\" />\n</Window>\n";
+
+            out << "</Window>\n";
+        }
+
+        out << "</Window>\n</GUILayout>\n";
+    }
+
+    ~LoadLayoutCase()
+    {
+        for (size_t i = 0; i < d_roots.size(); ++i)
+            WindowManager::getSingleton().destroyWindow(d_roots[i]);
+        WindowManager::getSingleton().cleanDeadPool();
+
+        std::remove(LayoutFile);
+    }
+
+    void run()
+    {
+        WindowManager& wm = WindowManager::getSingleton();
+        for (uint i = 0; i < d_ops; ++i)
+            d_roots.push_back(wm.loadWindowLayout(LayoutFile,
+                                                  makeName("layout", i)));
+    }
+
+private:
+    const uint d_ops;
+    std::vector<Window*> d_roots;
+};
+
+const char* const LoadLayoutCase::LayoutFile = "CoreBenchmark.layout";
+
+//----------------------------------------------------------------------------//
+// moves the mouse over a tree 32 levels deep, with two siblings per level.
+class MouseMoveCase
+{
+public:
+    MouseMoveCase(uint ops) : d_ops(ops)
+    {
+        d_root = createChild(0, "mm_root");
+        System::getSingleton().setGUISheet(d_root);
+
+        Window* parent = d_root;
+        for (uint level = 0; level < 32; ++level)
+        {
+            for (uint s = 0; s < 2; ++s)
+            {
+                Window* sibling =
+                    createChild(parent, makeName("mm_sib", level * 2 + s));
+                sibling->setArea(UDim(0.5f * s, 0), UDim(0, 0),
+                                 UDim(0.25f, 0), UDim(0.1f, 0));
+            }
+
+            Window* next = createChild(parent, makeName("mm_lvl", level));
+            next->setArea(UDim(0, 2), UDim(0, 2), UDim(1, -4), UDim(1, -4));
+            parent = next;
+        }
+    }
+
+    ~MouseMoveCase()
+    {
+        System::getSingleton().setGUISheet(0);
+        destroyTree(d_root);
+    }
+
+    void run()
+    {
+        System& sys = System::getSingleton();
+        sys.injectMousePosition(0, 0);
+
+        // sweep back and forth across the display in a fixed pattern.
+        for (uint i = 0; i < d_ops; ++i)
+            sys.injectMouseMove((i & 64) ? -7.0f : 7.0f,
+                                (i & 128) ? -3.0f : 3.0f);
+    }
+
+private:
+    const uint d_ops;
+    Window* d_root;
+};
+
+//----------------------------------------------------------------------------//
+// alternates the area of a window with 16 children between two values.
+class SetAreaCase
+{
+public:
+    SetAreaCase(uint ops) : d_ops(ops)
+    {
+        d_root = createChild(0, "sa_root");
+        System::getSingleton().setGUISheet(d_root);
+
+        d_target = createChild(d_root, "sa_target");
+        for (uint i = 0; i < 16; ++i)
+            createChild(d_target, makeName("sa_child", i))->setArea(
+                UDim(0, 0), UDim(i / 16.0f, 0), UDim(1, 0), UDim(0, 16));
+    }
+
+    ~SetAreaCase()
+    {
+        System::getSingleton().setGUISheet(0);
+        destroyTree(d_root);
+    }
+
+    void run()
+    {
+        for (uint i = 0; i < d_ops; ++i)
+            d_target->setArea(UDim(0, (i & 1) ? 10.0f : 20.0f), UDim(0, 10),
+                              UDim(0.5f, (i & 1) ? 0.0f : 8.0f), UDim(0.5f, 0));
+    }
+
+private:
+    const uint d_ops;
+    Window* d_root;
+    Window* d_target;
+};
+
+//----------------------------------------------------------------------------//
+// injects time pulses into a sheet of groups * 10 windows (1000 by default).
+class TimePulseCase
+{
+public:
+    TimePulseCase(uint ops, uint groups = 100) : d_ops(ops)
+    {
+        d_root = createChild(0, "tp_root");
+        System::getSingleton().setGUISheet(d_root);
+
+        for (uint i = 0; i < groups; ++i)
+        {
+            Window* group = createChild(d_root, makeName("tp_group", i));
+            for (uint j = 0; j < 9; ++j)
+                createChild(group, makeName("tp_item", i * 9 + j));
+        }
+    }
+
+    virtual ~TimePulseCase()
+    {
+        System::getSingleton().setGUISheet(0);
+        destroyTree(d_root);
+    }
+
+    void run()
+    {
+        System& sys = System::getSingleton();
+        for (uint i = 0; i < d_ops; ++i)
+            sys.injectTimePulse(1.0f / 60.0f);
+    }
+
+private:
+    const uint d_ops;
+    Window* d_root;
+};
+
+//----------------------------------------------------------------------------//
+// as TimePulseCase, with scheduled time pulses and no time dependent windows.
+class ScheduledTimePulseCase : public TimePulseCase
+{
+public:
+    ScheduledTimePulseCase(uint ops) : TimePulseCase(ops)
+    {
+        System::getSingleton().setScheduledTimePulsesEnabled(true);
+    }
+
+    ~ScheduledTimePulseCase()
+    {
+        System::getSingleton().setScheduledTimePulsesEnabled(false);
+    }
+};
+
+//----------------------------------------------------------------------------//
+// as TimePulseCase with 10000 windows.  Nothing subscribes to
+// EventWindowUpdated, so firing it returns without any lookup.
+class LargeTimePulseCase : public TimePulseCase
+{
+public:
+    LargeTimePulseCase(uint ops) : TimePulseCase(ops, 1000)
+    {
+    }
+};
+
+//----------------------------------------------------------------------------//
+bool onGlobalWindowUpdated(const EventArgs&)
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+// as LargeTimePulseCase, with a global EventWindowUpdated subscriber in an
+// unrelated namespace, so that every window takes the global event lookup
+// path.  GlobalEventSet keeps the event flagged as subscribed once this has
+// run, so it has to run after LargeTimePulseCase.
+class GlobalSubscribedTimePulseCase : public LargeTimePulseCase
+{
+public:
+    GlobalSubscribedTimePulseCase(uint ops) : LargeTimePulseCase(ops)
+    {
+        d_connection = GlobalEventSet::getSingleton().subscribeEvent(
+            "Unrelated/" + Window::EventWindowUpdated.getName(),
+            Event::Subscriber(&onGlobalWindowUpdated));
+    }
+
+    ~GlobalSubscribedTimePulseCase()
+    {
+        d_connection->disconnect();
+    }
+
+private:
+    Event::Connection d_connection;
+};
+
+//----------------------------------------------------------------------------//
+// in-process ScriptModule whose "script functions" are C++ functions
+// registered by name, to measure the cost of calling scripted handlers
+// without a script language.  Resolving can be switched off to measure
+// calling handlers by name.
+class StubScriptModule : public ScriptModule
+{
+public:
+    typedef bool (*Function)(const EventArgs&);
+
+    StubScriptModule(bool resolve) : d_resolve(resolve)
+    {
+        d_identifierString = "CoreBenchmark stub script module";
+    }
+
+    void registerFunction(const String& name, Function function)
+    {
+        d_functions[name] = function;
+        invalidateResolvedHandlers();
+    }
+
+    void executeScriptFile(const String&, const String&)
+    {
+        invalidateResolvedHandlers();
+    }
+
+    int executeScriptGlobal(const String& function_name)
+    {
+        return executeScriptedEventHandler(function_name, EventArgs());
+    }
+
+    bool executeScriptedEventHandler(const String& handler_name,
+                                     const EventArgs& e)
+    {
+        const FunctionMap::const_iterator i = d_functions.find(handler_name);
+        return i != d_functions.end() && i->second(e);
+    }
+
+    void executeString(const String&)
+    {
+        invalidateResolvedHandlers();
+    }
+
+    Event::Connection subscribeEvent(EventSet* target, const String& name,
+                                     const String& subscriber_name)
+    {
+        return target->subscribeEvent(name,
+            Event::Subscriber(ScriptFunctor(subscriber_name)));
+    }
+
+    Event::Connection subscribeEvent(EventSet* target, const String& name,
+                                     Event::Group group,
+                                     const String& subscriber_name)
+    {
+        return target->subscribeEvent(name, group,
+            Event::Subscriber(ScriptFunctor(subscriber_name)));
+    }
+
+    int resolveScriptedEventHandler(const String& handler_name)
+    {
+        const FunctionMap::const_iterator i = d_functions.find(handler_name);
+        if (!d_resolve || i == d_functions.end())
+            return NoResolvedHandler;
+
+        d_resolved.push_back(i->second);
+        return static_cast<int>(d_resolved.size() - 1);
+    }
+
+    bool executeResolvedEventHandler(int handle, const EventArgs& e)
+    {
+        return d_resolved[handle](e);
+    }
+
+private:
+    typedef std::map<String, Function, String::FastLessCompare> FunctionMap;
+
+    const bool d_resolve;
+    FunctionMap d_functions;
+    std::vector<Function> d_resolved;
+};
+
+//----------------------------------------------------------------------------//
+bool scriptedHandler(const EventArgs&)
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+// fires an event with a scripted subscriber, on a StubScriptModule holding
+// 500 functions.  The handler is called by name unless Resolve is true.
+template<bool Resolve>
+class ScriptedEventCase
+{
+public:
+    ScriptedEventCase(uint ops) :
+        d_ops(ops),
+        d_module(Resolve),
+        d_eventName("ScriptedBenchmark")
+    {
+        for (uint i = 0; i < 500; ++i)
+            d_module.registerFunction(makeName("Benchmark.onEvent", i),
+                                      &scriptedHandler);
+
+        System::getSingleton().setScriptingModule(&d_module);
+
+        d_window = createChild(0, "se_window");
+        d_window->subscribeScriptedEvent(d_eventName, "Benchmark.onEvent250");
+    }
+
+    ~ScriptedEventCase()
+    {
+        destroyTree(d_window);
+        System::getSingleton().setScriptingModule(0);
+    }
+
+    void run()
+    {
+        WindowEventArgs args(d_window);
+
+        for (uint i = 0; i < d_ops; ++i)
+            d_window->fireEvent(d_eventName, args, Window::EventNamespace);
+    }
+
+private:
+    const uint d_ops;
+    StubScriptModule d_module;
+    const EventID d_eventName;
+    Window* d_window;
+};
+
+//----------------------------------------------------------------------------//
+class SetPropertyCase
+{
+public:
+    SetPropertyCase(uint ops) : d_ops(ops)
+    {
+        d_window = createChild(0, "sp_window");
+    }
+
+    ~SetPropertyCase()
+    {
+        destroyTree(d_window);
+    }
+
+    void run()
+    {
+        static const String alpha("Alpha");
+        static const String values[2] = { String("0.5"), String("1") };
+
+        for (uint i = 0; i < d_ops; ++i)
+            d_window->setProperty(alpha, values[i & 1]);
+    }
+
+private:
+    const uint d_ops;
+    Window* d_window;
+};
+
+//----------------------------------------------------------------------------//
+// builds a 256 code point string by appending 32 pieces of 8.
+class StringAppendCase
+{
+public:
+    StringAppendCase(uint ops) : d_ops(ops), d_piece("abcdefgh"), d_length(0)
+    {}
+
+    void run()
+    {
+        for (uint i = 0; i < d_ops; ++i)
+        {
+            String s;
+            for (int p = 0; p < 32; ++p)
+                s += d_piece;
+
+            d_length += s.length();
+        }
+    }
+
+private:
+    const uint d_ops;
+    const String d_piece;
+    size_t d_length;
+};
+
+//----------------------------------------------------------------------------//
+// joins a window name path as done when generating child window names.
+class StringConcatCase
+{
+public:
+    StringConcatCase(uint ops) :
+        d_ops(ops),
+        d_parent("Root/MainFrame/ContentPane"),
+        d_sep("/"),
+        d_child("__auto_titlebar__"),
+        d_length(0)
+    {}
+
+    void run()
+    {
+        for (uint i = 0; i < d_ops; ++i)
+            d_length += (d_parent + d_sep + d_child).length();
+    }
+
+private:
+    const uint d_ops;
+    const String d_parent;
+    const String d_sep;
+    const String d_child;
+    size_t d_length;
+};
+
+//----------------------------------------------------------------------------//
+// asks a window name for its utf8 encoding, as logging and the XML
+// serialiser do.
+class StringCStrCase
+{
+public:
+    StringCStrCase(uint ops) :
+        d_ops(ops),
+        d_name("Root/MainFrame/ContentPane/__auto_titlebar__"),
+        d_length(0)
+    {}
+
+    void run()
+    {
+        for (uint i = 0; i < d_ops; ++i)
+            d_length += std::strlen(d_name.c_str());
+    }
+
+private:
+    const uint d_ops;
+    const String d_name;
+    size_t d_length;
+};
+
+//----------------------------------------------------------------------------//
+// writes through an iterator and a reference taken before the first c_str()
+// call, then asks for the utf8 encoding again; fails the run if the encoding
+// does not show the writes.
+class StringCStrWriteCase
+{
+public:
+    StringCStrWriteCase(uint ops) :
+        d_ops(ops),
+        d_text("hello"),
+        d_first(d_text.begin()),
+        d_second(d_text[1])
+    {}
+
+    void run()
+    {
+        d_text.c_str();
+
+        for (uint i = 0; i < d_ops; ++i)
+        {
+            *d_first = (i & 1) ? 'h' : 'J';
+            d_second = (i & 1) ? 'e' : 'E';
+
+            if (std::strcmp(d_text.c_str(), (i & 1) ? "hello" : "JEllo"))
+            {
+                std::fprintf(stderr, "String::c_str returned stale data "
+                             "'%s' after writes through an iterator\n",
+                             d_text.c_str());
+                std::exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+private:
+    const uint d_ops;
+    String d_text;
+    const String::iterator d_first;
+    utf32& d_second;
+};
+
+//----------------------------------------------------------------------------//
+// decodes the attributes of a layout element from utf8, as the XML parser
+// does, and encodes them again, as logging and the XML serialiser do.  One
+// value holds non-ASCII text.
+class StringTranscodeCase
+{
+public:
+    StringTranscodeCase(uint ops) : d_ops(ops), d_length(0)
+    {}
+
+    void run()
+    {
+        static const char* const attributes[] =
+        {
+            "Window",
+            "TaharezLook/FrameWindow",
+            "Root/MainFrame/ContentPane/__auto_titlebar__",
+            "UnifiedAreaRect",
+            "{{0.05,0},{0.05,0},{0.95,0},{0.95,0}}",
+            "Text",
+            "Caf\xC3\xA9 \xE2\x80\x93 \xC3\x9C" "bersicht der Einstellungen",
+            "Tooltip",
+            "Click here to apply the current settings and close the window."
+        };
+        static const uint count = sizeof(attributes) / sizeof(attributes[0]);
+
+        for (uint i = 0; i < d_ops; ++i)
+        {
+            const String value(
+                reinterpret_cast<const utf8*>(attributes[i % count]));
+            d_length += std::strlen(value.c_str());
+        }
+    }
+
+private:
+    const uint d_ops;
+    size_t d_length;
+};
+
+//----------------------------------------------------------------------------//
+// builds a 4096 code point string one code point at a time, as the XML
+// handlers do with element text.
+class StringAppendCodePointCase
+{
+public:
+    StringAppendCodePointCase(uint ops) : d_ops(ops), d_length(0)
+    {}
+
+    void run()
+    {
+        for (uint i = 0; i < d_ops; ++i)
+        {
+            String s;
+            for (utf32 c = 0; c < 4096; ++c)
+                s += static_cast<utf32>('a' + c % 26);
+
+            d_length += s.length();
+        }
+    }
+
+private:
+    const uint d_ops;
+    size_t d_length;
+};
+
+//----------------------------------------------------------------------------//
+// assigns the String returned by getProperty; with move assignment the
+// returned String is not copied again.
+class GetPropertyCase
+{
+public:
+    GetPropertyCase(uint ops) : d_ops(ops), d_length(0)
+    {
+        d_window = createChild(0, "gp_window");
+        d_window->setText(String(64, 'x'));
+    }
+
+    ~GetPropertyCase()
+    {
+        destroyTree(d_window);
+    }
+
+    void run()
+    {
+        static const String text("Text");
+
+        for (uint i = 0; i < d_ops; ++i)
+        {
+            d_value = d_window->getProperty(text);
+            d_length += d_value.length();
+        }
+    }
+
+private:
+    const uint d_ops;
+    Window* d_window;
+    String d_value;
+    size_t d_length;
+};
+
+//----------------------------------------------------------------------------//
+// looks windows up by name among 1000 registered windows.  The names are
+// passed as Strings, or as char strings if Literal is true, which are
+// looked up without constructing a String.
+template<bool Literal>
+class GetWindowCase
+{
+public:
+    GetWindowCase(uint ops) : d_ops(ops), d_found(0)
+    {
+        d_root = createChild(0, "gw_root");
+        for (uint i = 0; i < WindowCount; ++i)
+        {
+            d_names.push_back(makeName("gw", i));
+            d_chars.push_back(d_names.back().c_str());
+            createChild(d_root, d_names.back());
+        }
+    }
+
+    ~GetWindowCase()
+    {
+        destroyTree(d_root);
+    }
+
+    void run()
+    {
+        WindowManager& wm = WindowManager::getSingleton();
+        for (uint i = 0; i < d_ops; ++i)
+        {
+            const uint idx = i % WindowCount;
+            if (Literal ? wm.getWindow(d_chars[idx].c_str()) :
+                          wm.getWindow(d_names[idx]))
+                ++d_found;
+        }
+    }
+
+private:
+    static const uint WindowCount = 1000;
+
+    const uint d_ops;
+    Window* d_root;
+    std::vector<String> d_names;
+    std::vector<std::string> d_chars;
+    uint d_found;
+};
+
+//----------------------------------------------------------------------------//
+// measures a 54 code point string with a pixmap font of 95 glyphs.
+class TextExtentCase
+{
+public:
+    TextExtentCase(uint ops) :
+        d_ops(ops),
+        d_text("The quick brown fox jumps over the lazy dog 0123456789"),
+        d_extent(0)
+    {
+        Texture& tex = System::getSingleton().getRenderer()->
+            createTexture(Size(256, 256));
+        d_imageset = &ImagesetManager::getSingleton().create("te_glyphs", tex);
+
+        for (utf32 cp = 32; cp < 127; ++cp)
+        {
+            const uint i = cp - 32;
+            d_imageset->defineImage(makeName("g", cp),
+                                    Point((i % 16) * 16.0f, (i / 16) * 16.0f),
+                                    Size(12, 16), Point(0, 0));
+        }
+
+        // the "*" resource group makes the font use the existing imageset.
+        d_font = new PixmapFont("te_font", "te_glyphs", "*");
+        for (utf32 cp = 32; cp < 127; ++cp)
+            d_font->defineMapping(cp, makeName("g", cp), 12.0f);
+    }
+
+    ~TextExtentCase()
+    {
+        delete d_font;
+        ImagesetManager::getSingleton().destroy(*d_imageset);
+    }
+
+    void run()
+    {
+        for (uint i = 0; i < d_ops; ++i)
+            d_extent += d_font->getTextExtent(d_text);
+    }
+
+private:
+    const uint d_ops;
+    const String d_text;
+    Imageset* d_imageset;
+    PixmapFont* d_font;
+    float d_extent;
+};
+
+//----------------------------------------------------------------------------//
+template<typename Case>
+void runCase(const char* name, uint ops, const char* filter)
+{
+    if (filter && !std::strstr(name, filter))
+        return;
+
+    double best_ns = 0;
+    double best_allocs = 0;
+
+    for (int rep = 0; rep < 3; ++rep)
+    {
+        Case c(ops);
+
+        const size_t allocs = s_allocations;
+        const uint64 start = Clock::getTime();
+        c.run();
+        const double ns =
+            static_cast<double>(Clock::getTime() - start) / ops;
+        const double allocs_per_op =
+            static_cast<double>(s_allocations - allocs) / ops;
+
+        if (rep == 0 || ns < best_ns)
+        {
+            best_ns = ns;
+            best_allocs = allocs_per_op;
+        }
+    }
+
+    std::printf("%-28s %10u %12.1f %12.2f\n", name, ops, best_ns, best_allocs);
+}
+
+}
+
+//----------------------------------------------------------------------------//
+int main(int argc, char* argv[])
+{
+    const char* const filter = (argc > 1) ? argv[1] : 0;
+
+    NullRenderer::bootstrapSystem(Size(1024, 768));
+
+    std::printf("%-28s %10s %12s %12s\n", "case", "ops", "ns/op", "allocs/op");
+
+    runCase<CreateWindowCase>("WindowManager::createWindow", 2000, filter);
+    runCase<LoadLayoutCase>("loadWindowLayout", 50, filter);
+    runCase<MouseMoveCase>("injectMouseMove/deep", 20000, filter);
+    runCase<SetAreaCase>("Window::setArea", 20000, filter);
+    runCase<TimePulseCase>("injectTimePulse/1000", 500, filter);
+    runCase<ScheduledTimePulseCase>("injectTimePulse/1000/sched", 500, filter);
+    runCase<LargeTimePulseCase>("injectTimePulse/10000", 50, filter);
+    runCase<GlobalSubscribedTimePulseCase>("injectTimePulse/10000/global", 50,
+                                           filter);
+    runCase<ScriptedEventCase<false> >("ScriptFunctor/by-name", 200000,
+                                       filter);
+    runCase<ScriptedEventCase<true> >("ScriptFunctor/resolved", 200000,
+                                      filter);
+    runCase<SetPropertyCase>("PropertySet::setProperty", 100000, filter);
+    runCase<StringAppendCase>("String::operator+=/32", 50000, filter);
+    runCase<StringConcatCase>("String::operator+", 200000, filter);
+    runCase<StringCStrCase>("String::c_str", 200000, filter);
+    runCase<StringCStrWriteCase>("String::c_str/written", 200000, filter);
+    runCase<StringTranscodeCase>("String::utf8 transcode", 200000, filter);
+    runCase<StringAppendCodePointCase>("String::operator+=/4096x1", 500,
+                                       filter);
+    runCase<GetPropertyCase>("PropertySet::getProperty", 100000, filter);
+    runCase<GetWindowCase<false> >("WindowManager::getWindow", 200000,
+                                   filter);
+    runCase<GetWindowCase<true> >("WindowManager::getWindow/lit", 200000,
+                                  filter);
+    runCase<TextExtentCase>("Font::getTextExtent", 100000, filter);
+
+    NullRenderer::destroySystem();
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+// Microbenchmark for CEGUI::VertexConversion.
+//
+// Compares the per-vertex conversion that the renderer modules used to do
+// (colour::getARGB and push_back for every vertex) against the scalar and
+// SIMD batch kernels, and checks that every kernel produces the same output.
+//
+// Build together with cegui/CEGUIVertexConversion.cpp and the CEGUIcolour.cpp
+// of a full CEGUI 0.7 checkout, which defines colour::getARGB; the cegui/
+// directory of this tree is a partial snapshot that only has CEGUIcolour.h.
+// Targets without SSE2 (or builds defining CEGUI_NO_SIMD) only have the
+// scalar kernel.
+
+#include "../cegui/CEGUIVertexConversion.h"
+#include "../cegui/CEGUIVertex.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if defined(_WIN32)
+#   include <windows.h>
+#else
+#   include <time.h>
+#endif
+
+using namespace CEGUI;
+
+namespace
+{
+//----------------------------------------------------------------------------//
+double now()
+{
+#if defined(_WIN32)
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return static_cast<double>(count.QuadPart) / freq.QuadPart;
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// the conversion loop the renderer modules used before VertexConversion.
+void convertLegacy(const Vertex* vbuff, uint vertex_count,
+                   std::vector<PackedVertex>& out)
+{
+    PackedVertex vd;
+    const Vertex* vs = vbuff;
+    for (uint i = 0; i < vertex_count; ++i, ++vs)
+    {
+        vd.x       = vs->position.d_x - 0.5f;
+        vd.y       = vs->position.d_y - 0.5f;
+        vd.z       = vs->position.d_z;
+        vd.diffuse = vs->colour_val.getARGB();
+        vd.tu      = vs->tex_coords.d_x;
+        vd.tv      = vs->tex_coords.d_y;
+        out.push_back(vd);
+    }
+}
+
+//----------------------------------------------------------------------------//
+typedef void (*KernelFunc)(const Vertex*, PackedVertex*, uint, float);
+
+//----------------------------------------------------------------------------//
+double timeKernel(KernelFunc kernel, const std::vector<Vertex>& src,
+                  std::vector<PackedVertex>& out, int iterations)
+{
+    const uint count = static_cast<uint>(src.size());
+    const double start = now();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        // mimic a GeometryBuffer being reset and refilled every frame.
+        out.clear();
+        out.resize(count);
+        kernel(&src[0], &out[0], count, -0.5f);
+    }
+
+    return (now() - start) * 1e9 / (static_cast<double>(iterations) * count);
+}
+
+//----------------------------------------------------------------------------//
+double timeLegacy(const std::vector<Vertex>& src,
+                  std::vector<PackedVertex>& out, int iterations)
+{
+    const uint count = static_cast<uint>(src.size());
+    const double start = now();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        out.clear();
+        convertLegacy(&src[0], count, out);
+    }
+
+    return (now() - start) * 1e9 / (static_cast<double>(iterations) * count);
+}
+
+//----------------------------------------------------------------------------//
+bool sameOutput(const std::vector<PackedVertex>& a,
+                const std::vector<PackedVertex>& b)
+{
+    return a.size() == b.size() &&
+           std::memcmp(&a[0], &b[0], a.size() * sizeof(PackedVertex)) == 0;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+int main()
+{
+    // roughly the vertex count of a text heavy window: 2000 glyph quads.
+    const uint vertex_count = 12000;
+    const int iterations = 2000;
+
+    std::vector<Vertex> src(vertex_count);
+    for (uint i = 0; i < vertex_count; ++i)
+    {
+        src[i].position = Vector3(static_cast<float>(i % 1024),
+                                  static_cast<float>(i / 1024), 0.0f);
+        src[i].tex_coords = Vector2((i % 64) / 64.0f, (i % 32) / 32.0f);
+        src[i].colour_val = colour((i % 256) / 255.0f, ((i * 7) % 256) / 255.0f,
+                                   ((i * 13) % 256) / 255.0f,
+                                   ((i * 29) % 256) / 255.0f);
+    }
+
+    std::vector<PackedVertex> reference, out;
+    convertLegacy(&src[0], vertex_count, reference);
+
+    std::printf("%u vertices, %d iterations\n\n", vertex_count, iterations);
+    std::printf("%-10s %10s %10s\n", "kernel", "ns/vertex", "speedup");
+
+    const double legacy = timeLegacy(src, out, iterations);
+    std::printf("%-10s %10.3f %10.2f\n", "legacy", legacy, 1.0);
+
+    struct { const char* name; KernelFunc func; } kernels[] =
+    {
+        { "scalar", &VertexConversion::convertScalar },
+#if defined(CEGUI_SIMD_SSE2)
+        { "SSE2", &VertexConversion::convertSSE2 },
+#endif
+    };
+
+    int result = 0;
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); ++k)
+    {
+        const double t = timeKernel(kernels[k].func, src, out, iterations);
+        const bool ok = sameOutput(reference, out);
+        std::printf("%-10s %10.3f %10.2f%s\n", kernels[k].name, t, legacy / t,
+                    ok ? "" : "  (output differs!)");
+
+        if (!ok)
+            result = 1;
+    }
+
+    std::printf("\nVertexConversion::convert uses the %s kernel.\n",
+                VertexConversion::getKernelName());
+
+    return result;
+}
@@ -30,6 +30,14 @@
 #   define CEGUI_RETHROW throw
 #endif
 
+// C++11 features used where the compiler supports them.
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#   define CEGUI_HAS_MOVE_SEMANTICS 1
+#   define CEGUI_NOEXCEPT noexcept
+#else
+#   define CEGUI_NOEXCEPT
+#endif
+
 
 //////////////////////////////////////////////////////////////////////////
 // Comment this line to remove the alignment of elements to pixel
@@ -73,6 +81,11 @@ typedef unsigned short	ushort;
 typedef unsigned int	uint;
 typedef unsigned char	uchar;
 
+#if defined(_MSC_VER)
+typedef unsigned __int64    uint64;
+#else
+typedef unsigned long long  uint64;
+#endif
 typedef unsigned int    uint32;
 typedef unsigned short  uint16;
 typedef unsigned char   uint8;
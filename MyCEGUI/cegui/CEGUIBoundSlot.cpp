@@ -1,40 +1,109 @@
 #include "CEGUIBoundSlot.h"
 #include "CEGUIEvent.h"
 
+#include <new>
+#include <vector>
+
 namespace CEGUI
 {
 
+namespace
+{
+
+// fixed size blocks for BoundSlots, handed out from a free list.
+class BoundSlotPool
+{
+public:
+	BoundSlotPool() :
+		d_free(0)
+	{}
+
+	void* allocate()
+	{
+		if (!d_free)
+			grow();
+
+		Block* const block = d_free;
+		d_free = block->d_next;
+		return block;
+	}
+
+	void deallocate(void* ptr)
+	{
+		Block* const block = static_cast<Block*>(ptr);
+		block->d_next = d_free;
+		d_free = block;
+	}
+
+private:
+	union Block
+	{
+		Block* d_next;
+		char d_storage[sizeof(BoundSlot)];
+		double d_align;
+	};
+
+	// number of blocks allocated at once.
+	enum { ChunkSize = 128 };
+
+	void grow()
+	{
+		Block* const chunk = new Block[ChunkSize];
+		d_chunks.push_back(chunk);
+
+		for (int i = 0; i < ChunkSize; ++i)
+			deallocate(&chunk[i]);
+	}
+
+	Block* d_free;
+	std::vector<Block*> d_chunks;
+};
+
+BoundSlotPool& getBoundSlotPool()
+{
+	// never destroyed, since Connections held by static objects may release
+	// their BoundSlot after any other static has gone.
+	static BoundSlotPool* pool = new BoundSlotPool;
+	return *pool;
+}
+
+}
+
 BoundSlot::BoundSlot(Group group, const SubscriberSlot& subscriber, Event& event) :
 	d_group(group),
-	d_subscriber(new SubscriberSlot(subscriber)),
+	d_subscriber(subscriber),
+	d_refCount(0),
 	d_event(&event)
 {}
 
-BoundSlot::BoundSlot(const BoundSlot& other) :
-	d_group(other.d_group),
-	d_subscriber(other.d_subscriber),
-	d_event(other.d_event)
+BoundSlot::~BoundSlot()
 {
+	disconnect();
 }
 
-BoundSlot::~BoundSlot()
+void* BoundSlot::operator new(size_t size)
 {
-	disconnect();
-	delete d_subscriber;
+	// classes derived from BoundSlot do not fit the pool's blocks.
+	if (size != sizeof(BoundSlot))
+		return ::operator new(size);
+
+	return getBoundSlotPool().allocate();
 }
 
-BoundSlot& BoundSlot::operator=(const BoundSlot& other)
+void BoundSlot::operator delete(void* ptr, size_t size)
 {
-	d_group      = other.d_group;
-	d_subscriber = other.d_subscriber;
-	d_event      = other.d_event;
+	if (!ptr)
+		return;
 
-	return *this;
+	if (size != sizeof(BoundSlot))
+		::operator delete(ptr);
+	else
+		getBoundSlotPool().deallocate(ptr);
 }
 
 bool BoundSlot::operator==(const BoundSlot& other) const
 {
-	return d_subscriber == other.d_subscriber;
+	return this == &other;
 }
 
 bool BoundSlot::operator!=(const BoundSlot& other) const
@@ -44,14 +113,14 @@ bool BoundSlot::operator!=(const BoundSlot& other) const
 
 bool BoundSlot::connected() const
 {
-	return (d_subscriber != 0) && d_subscriber->connected();
+	return d_subscriber.connected();
 }
 
 void BoundSlot::disconnect()
 {
 	// cleanup the bound subscriber functor
 	if (connected())
-		d_subscriber->cleanup();
+		d_subscriber.cleanup();
 	// remove the owning Event's reference to us
 	if (d_event)
 	{
@@ -61,4 +130,4 @@ void BoundSlot::disconnect()
 	}
 }
 
-}
\ No newline at end of file
+}
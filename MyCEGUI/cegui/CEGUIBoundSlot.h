@@ -1,5 +1,10 @@
+#pragma once
+
 #include "CEGUIBase.h"
 #include "CEGUISubscriberSlot.h"
+#include "CEGUIRefCounted.h"
+
+#include <cstddef>
 
 namespace CEGUI
 {
@@ -11,9 +16,7 @@ public:
     typedef unsigned int Group;
 	//µSubscriberSlotгʼ
     BoundSlot(Group group, const SubscriberSlot& subscriber, Event& event);
-	//µSubscriberSlotиƣSubscriberSlotɱͷ
-    BoundSlot(const BoundSlot& other);
-	//disconnectdelete d_subscriberָĶ
+	//disconnect
     ~BoundSlot();
 	//ǷӦ¼
     bool connected() const;
@@ -23,12 +26,25 @@ public:
     bool operator==(const BoundSlot& other) const;
     bool operator!=(const BoundSlot& other) const;
 
+    /*!
+    \brief
+        BoundSlots are allocated from a shared pool of fixed size blocks, so
+        subscribing to an event does not normally touch the heap.  The pool
+        keeps its memory for the lifetime of the process; like the rest of
+        the event system it must only be used from the GUI thread.
+    */
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
+
 private:
     friend class Event;
-    // no assignment.
+    friend class RefCounted<BoundSlot>;
+    // no copying or assignment.
+    BoundSlot(const BoundSlot& other);
     BoundSlot& operator=(const BoundSlot& other);
     Group d_group;                  //! The group the slot subscription used.
-    SubscriberSlot* d_subscriber;   //! The actual slot object.
+    SubscriberSlot d_subscriber;    //! The actual slot object.
+    unsigned int d_refCount;        //! Number of Connections referring to us.
     Event* d_event;                 //! The event to which the slot was attachedɽзע
 };
 
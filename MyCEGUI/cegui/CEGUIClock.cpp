@@ -0,0 +1,60 @@
+#include "CEGUIClock.h"
+
+#if defined(__WIN32__) || defined(_WIN32)
+#   include <windows.h>
+#elif defined(__APPLE__)
+#   include <mach/mach_time.h>
+#else
+#   include <time.h>
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+uint64 Clock::getTime()
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    static LARGE_INTEGER frequency = {0};
+    if (!frequency.QuadPart)
+        QueryPerformanceFrequency(&frequency);
+
+    LARGE_INTEGER count;
+    QueryPerformanceCounter(&count);
+
+    // split the conversion so that count * 10^9 can not overflow.
+    const uint64 freq = static_cast<uint64>(frequency.QuadPart);
+    const uint64 ticks = static_cast<uint64>(count.QuadPart);
+
+    return (ticks / freq) * 1000000000 +
+           (ticks % freq) * 1000000000 / freq;
+#elif defined(__APPLE__)
+    static mach_timebase_info_data_t timebase = {0, 0};
+    if (!timebase.denom)
+        mach_timebase_info(&timebase);
+
+    return mach_absolute_time() * timebase.numer / timebase.denom;
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return static_cast<uint64>(ts.tv_sec) * 1000000000 +
+           static_cast<uint64>(ts.tv_nsec);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+double Clock::getSeconds()
+{
+    return static_cast<double>(getTime()) * 1e-9;
+}
+
+//----------------------------------------------------------------------------//
+double Clock::toSeconds(uint64 start, uint64 end)
+{
+    return static_cast<double>(end - start) * 1e-9;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
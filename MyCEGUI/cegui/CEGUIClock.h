@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CEGUIBase.h"
+
+namespace CEGUI
+{
+/*!
+\brief
+    Portable monotonic clock with nanosecond units.
+
+    Values returned by the clock have an arbitrary origin and are only
+    meaningful relative to each other; they never go backwards.  The actual
+    resolution depends on the platform - QueryPerformanceCounter on Windows,
+    mach_absolute_time on Mac OS X and clock_gettime(CLOCK_MONOTONIC)
+    elsewhere - and is typically well below a microsecond.
+*/
+class Clock
+{
+public:
+    //! Return the current time in nanoseconds.
+    static uint64 getTime();
+
+    //! Return the current time in seconds.
+    static double getSeconds();
+
+    //! Return the difference in seconds between two values from getTime.
+    static double toSeconds(uint64 start, uint64 end);
+};
+
+}
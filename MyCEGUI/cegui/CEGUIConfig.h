@@ -8,4 +8,19 @@
 //
 // The Premake solution will generate these for you according to the
 // config.lua script.
-//////////////////////////////////////////////////////////////////////////
\ No newline at end of file
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+// Number of code points each String holds without allocating (32 by
+// default).  Each code point takes four bytes of every String - and a
+// Window holds several - so a smaller value trades memory for more
+// allocations with longer strings.
+//////////////////////////////////////////////////////////////////////////
+//#define STR_QUICKBUFF_SIZE 16
+
+//////////////////////////////////////////////////////////////////////////
+// Where the target has SSE2, String converts between utf8 and utf32 and
+// the renderers convert vertices with SSE2 code.  Define this to always
+// use the portable scalar code instead.
+//////////////////////////////////////////////////////////////////////////
+//#define CEGUI_NO_SIMD
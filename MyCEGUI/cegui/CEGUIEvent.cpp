@@ -1,5 +1,6 @@
 #include "CEGUIEvent.h"
 #include "CEGUIEventArgs.h"
+#include "CEGUIEventTracer.h"
 
 #include <algorithm>
 
@@ -13,9 +14,10 @@ public:
         d_s(s)
     {}
 
-    bool operator()(std::pair<Event::Group, Event::Connection> e) const
+    template<typename Slot>
+    bool operator()(const Slot& e) const
     {
-        return *(e.second) == d_s;
+        return e.d_subscriber && *e.d_connection == d_s;
     }
 
 private:
@@ -25,20 +27,54 @@ private:
 
 
 
+class Event::DispatchGuard
+{
+public:
+    DispatchGuard(Event& event) :
+        d_event(event)
+    {
+        ++d_event.d_dispatchDepth;
+    }
+
+    ~DispatchGuard()
+    {
+        if (!--d_event.d_dispatchDepth)
+            d_event.applyDeferredChanges();
+    }
+
+private:
+    void operator=(const DispatchGuard&) {}
+    Event& d_event;
+};
+
+
+Event::Slot::Slot(Group group, const Connection& connection,
+                  SubscriberSlot* subscriber) :
+    d_group(group),
+    d_connection(connection),
+    d_subscriber(subscriber)
+{
+}
+
+
 Event::Event(const String& name) :
+    d_removedCount(0),
+    d_dispatchDepth(0),
     d_name(name)
 {
 }
 
 Event::~Event()
 {
+    applyDeferredChanges();
+
     SlotContainer::iterator iter(d_slots.begin());
     const SlotContainer::const_iterator end_iter(d_slots.end());
 
     for (; iter != end_iter; ++iter)
     {
-        iter->second->d_event = 0;
-        iter->second->d_subscriber->cleanup();
+        iter->d_connection->d_event = 0;
+        iter->d_subscriber->cleanup();
     }
 
     d_slots.clear();
@@ -53,19 +89,35 @@ Event::Connection Event::subscribe(const Event::Subscriber& slot)   //û
 Event::Connection Event::subscribe(Event::Group group, const Event::Subscriber& slot)
 {
     Event::Connection c(new BoundSlot(group, slot, *this));    //this¼¼ָ
-    d_slots.insert(std::pair<Group, Connection>(group, c));
+
+    // handlers subscribing during dispatch take effect from the next one.
+    if (d_dispatchDepth)
+        d_pendingSlots.push_back(Slot(group, c, &c->d_subscriber));
+    else
+        insertSlot(Slot(group, c, &c->d_subscriber));
+
     return c;
 }
 
 void Event::operator()(EventArgs& args)
 {
-    SlotContainer::iterator iter(d_slots.begin());
-    const SlotContainer::const_iterator end_iter(d_slots.end());
+    DispatchGuard guard(*this);
+    EventTracer* const tracer = EventTracer::getActive();
+
+    // d_slots is not resized while dispatching, so index based iteration
+    // stays valid whatever the handlers subscribe or unsubscribe.
+    const size_t count = d_slots.size();
 
     // execute all subscribers, updating the 'handled' state as we go
-    for (; iter != end_iter; ++iter)
-        if ((*iter->second->d_subscriber)(args))
+    for (size_t i = 0; i < count; ++i)
+    {
+        SubscriberSlot* const subscriber = d_slots[i].d_subscriber;
+        if (!subscriber)
+            continue;
+
+        if (tracer ? tracer->invoke(*subscriber, args) : (*subscriber)(args))
             ++args.handled;                   //¼¼Ĵ
+    }
 }
 
 void Event::unsubscribe(const BoundSlot& slot)
@@ -76,9 +128,55 @@ void Event::unsubscribe(const BoundSlot& slot)
                      d_slots.end(),
                      SubComp(slot));
 
-    // erase our reference to the slot, if we had one.
     if (curr != d_slots.end())
-        d_slots.erase(curr);                //Զ¼
+    {
+        // during dispatch the slot is only cleared, and erased afterwards.
+        if (d_dispatchDepth)
+        {
+            curr->d_subscriber = 0;
+            ++d_removedCount;
+        }
+        else
+            d_slots.erase(curr);                //Զ¼
+
+        return;
+    }
+
+    curr = std::find_if(d_pendingSlots.begin(),
+                        d_pendingSlots.end(),
+                        SubComp(slot));
+
+    if (curr != d_pendingSlots.end())
+        d_pendingSlots.erase(curr);
+}
+
+void Event::insertSlot(const Slot& slot)
+{
+    d_slots.insert(std::upper_bound(d_slots.begin(), d_slots.end(),
+                                    slot.d_group, SlotGroupLess()),
+                   slot);
+}
+
+void Event::applyDeferredChanges()
+{
+    if (d_removedCount)
+    {
+        SlotContainer::iterator out = d_slots.begin();
+        for (SlotContainer::iterator in = d_slots.begin();
+             in != d_slots.end(); ++in)
+        {
+            if (in->d_subscriber)
+                *out++ = *in;
+        }
+
+        d_slots.erase(out, d_slots.end());
+        d_removedCount = 0;
+    }
+
+    for (size_t i = 0; i < d_pendingSlots.size(); ++i)
+        insertSlot(d_pendingSlots[i]);
+
+    d_pendingSlots.clear();
 }
 
 }
\ No newline at end of file
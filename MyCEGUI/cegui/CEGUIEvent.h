@@ -5,7 +5,7 @@
 #include "CEGUISubscriberSlot.h"
 #include "CEGUIRefCounted.h"
 
-#include <map>
+#include <vector>
 
 namespace CEGUI
 {
@@ -63,6 +63,10 @@ public:
 	//е¼
     void operator()(EventArgs& args);
 
+    //! Return the number of subscribers currently connected to the event.
+    size_t getConnectionCount() const
+        { return d_slots.size() + d_pendingSlots.size() - d_removedCount; }
+
 
 private:
     friend void CEGUI::BoundSlot::disconnect();  //ע
@@ -73,8 +77,48 @@ private:
     Event(const Event&) {}
     Event& operator=(const Event&)  {return *this;}
 
-    typedef std::multimap<Group, Connection> SlotContainer;
+    //! A subscription, as held by the Event.
+    struct Slot
+    {
+        Slot(Group group, const Connection& connection,
+             SubscriberSlot* subscriber);
+
+        Group d_group;
+        //! keeps the BoundSlot - and so d_subscriber - alive.
+        Connection d_connection;
+        //! the bound subscriber, or 0 once unsubscribed during dispatch.
+        SubscriberSlot* d_subscriber;
+    };
+
+    //! orders Slots by group.
+    struct SlotGroupLess
+    {
+        bool operator()(const Slot& slot, Group group) const
+            { return slot.d_group < group; }
+        bool operator()(Group group, const Slot& slot) const
+            { return group < slot.d_group; }
+    };
+
+    //! Tracks dispatch depth, applying deferred changes on leaving the last.
+    class DispatchGuard;
+    friend class DispatchGuard;
+
+    //! add \a slot after all slots of the same or a lower group.
+    void insertSlot(const Slot& slot);
+    //! apply the changes deferred while the event was being dispatched.
+    void applyDeferredChanges();
+
+    /*!
+        Slots sorted by group, and in subscription order within a group, so
+        dispatch is a walk over contiguous memory.  While the event is being
+        dispatched d_slots is not resized: new subscriptions are queued in
+        d_pendingSlots, and removed ones are only cleared in place.
+    */
+    typedef std::vector<Slot> SlotContainer;
     SlotContainer d_slots;  //!< Collection holding ref-counted bound slots
+    SlotContainer d_pendingSlots;   //!< subscriptions made during dispatch
+    size_t d_removedCount;  //!< slots cleared in d_slots during dispatch
+    uint d_dispatchDepth;   //!< number of dispatches in progress
     const String d_name;    //!< Name of this event
 };
 
@@ -0,0 +1,107 @@
+#include "CEGUIEventID.h"
+#include "CEGUIInternedStringMap.h"
+
+#include <map>
+#include <vector>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+namespace
+{
+// the tables are created on first use, since EventID constants are
+// constructed during static initialisation.
+struct InternTable
+{
+    typedef InternedStringMap<uint> NameMap;
+    typedef std::map<std::pair<uint, uint>, uint> NamespacedMap;
+
+    //! event names and their ids.
+    NameMap d_ids;
+    //! the name of each id; points at the pooled Strings of the keys of
+    //! d_ids, which stay pooled as long as the keys exist.
+    std::vector<const String*> d_names;
+    //! ids of global event names, by namespace and event id.
+    NamespacedMap d_namespaced;
+
+    uint intern(const StringView& name)
+    {
+        NameMap::iterator i = d_ids.find(InternedString::find(name));
+
+        if (i == d_ids.end())
+        {
+            const InternedString key(name.str());
+            d_ids[key] = static_cast<uint>(d_names.size());
+            i = d_ids.find(key);
+            d_names.push_back(&i->first.str());
+        }
+
+        return i->second;
+    }
+};
+
+InternTable& getInternTable()
+{
+    static InternTable table;
+    return table;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+EventID::EventID(const StringView& name)
+{
+    InternTable& table = getInternTable();
+    d_id = table.intern(name);
+    d_name = table.d_names[d_id];
+}
+
+//----------------------------------------------------------------------------//
+EventID EventID::find(const StringView& name)
+{
+    InternTable& table = getInternTable();
+    const InternTable::NameMap::const_iterator i =
+        table.d_ids.find(InternedString::find(name));
+
+    if (i == table.d_ids.end())
+    {
+        static const String none;
+        return EventID(InvalidID, &none);
+    }
+
+    return EventID(i->second, table.d_names[i->second]);
+}
+
+//----------------------------------------------------------------------------//
+EventID EventID::getNamespacedID(const EventID& event_namespace,
+                                 const EventID& name)
+{
+    InternTable& table = getInternTable();
+    const std::pair<uint, uint> key(event_namespace.d_id, name.d_id);
+
+    InternTable::NamespacedMap::iterator i = table.d_namespaced.find(key);
+
+    if (i == table.d_namespaced.end())
+        i = table.d_namespaced.insert(std::make_pair(key,
+                table.intern(event_namespace.getName() + "/" +
+                             name.getName()))).first;
+
+    return EventID(i->second, table.d_names[i->second]);
+}
+
+//----------------------------------------------------------------------------//
+uint EventID::getInternedCount()
+{
+    return static_cast<uint>(getInternTable().d_names.size());
+}
+
+//----------------------------------------------------------------------------//
+const String& EventID::getNameForID(uint id)
+{
+    return *getInternTable().d_names[id];
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CEGUIBase.h"
+#include "CEGUIString.h"
+#include "CEGUIStringView.h"
+
+namespace CEGUI
+{
+/*!
+\brief
+    Interned event name.
+
+    Constructing an EventID looks its name up in a process wide table, adding
+    it if it is not there yet, and stores the resulting integer; from then on
+    EventIDs are compared, and EventSets look events up, by that integer
+    alone.  Event name constants that are fired often - such as the
+    Window::Event* constants - are EventIDs, so firing them involves neither
+    String allocation nor String comparisons.
+
+    An EventID converts implicitly to the String it was created from, and to
+    a StringView of it, so it can be used wherever an event name String or
+    StringView is expected.
+*/
+class EventID
+{
+public:
+    /*!
+    \brief
+        Construct an EventID for the event named \a name.  This performs the
+        table lookup, so EventIDs for constant names are best created once
+        and kept.  Looking up a name that was interned before does not
+        allocate.
+    */
+    explicit EventID(const StringView& name);
+
+    /*!
+    \brief
+        Return the EventID for the event named \a name if that name has been
+        interned, or an invalid EventID if it has not.
+
+        Unlike the constructor this never adds to the table, so it is what
+        functions that only look a name up use: a name that was never
+        interned can not name an existing event or subscription, and names
+        passed in from scripts or other threads do not grow the table.
+    */
+    static EventID find(const StringView& name);
+
+    //! id of the invalid EventIDs returned by find.
+    static const uint InvalidID = static_cast<uint>(-1);
+
+    //! Return whether this EventID was interned; only find returns EventIDs
+    //! that are not, and their name is empty.
+    bool isValid() const
+        { return d_id != InvalidID; }
+
+    //! Return the integer identifying the event name.
+    uint getID() const
+        { return d_id; }
+
+    //! Return the event name.
+    const String& getName() const
+        { return *d_name; }
+
+    operator const String&() const
+        { return *d_name; }
+
+    operator StringView() const
+        { return StringView(*d_name); }
+
+    bool operator==(const EventID& other) const
+        { return d_id == other.d_id; }
+
+    bool operator!=(const EventID& other) const
+        { return d_id != other.d_id; }
+
+    bool operator<(const EventID& other) const
+        { return d_id < other.d_id; }
+
+    /*!
+    \brief
+        Return the EventID of the global event name formed by
+        \a event_namespace, a '/' and \a name, as used by the GlobalEventSet.
+        The name is only built the first time a combination is seen.
+    */
+    static EventID getNamespacedID(const EventID& event_namespace,
+                                   const EventID& name);
+
+    //! Return the number of distinct event names interned so far.
+    static uint getInternedCount();
+
+    //! Return the event name with the id \a id, which must be a valid id.
+    static const String& getNameForID(uint id);
+
+private:
+    //! construct from an existing table entry.
+    EventID(uint id, const String* name) : d_id(id), d_name(name) {}
+
+    uint d_id;
+    //! the name, as held in the intern table.
+    const String* d_name;
+};
+
+}
@@ -0,0 +1,121 @@
+#include "CEGUIEventQueue.h"
+#include "CEGUIWindow.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+EventQueue::Entry::Entry(Window& window, const EventID& name,
+                         const EventID& event_namespace, bool local) :
+    d_window(&window),
+    d_name(name),
+    d_namespace(event_namespace),
+    d_local(local)
+{
+}
+
+//----------------------------------------------------------------------------//
+EventQueue::EventQueue()
+{
+}
+
+//----------------------------------------------------------------------------//
+void EventQueue::setDeferred(const EventID& name, bool setting)
+{
+    if (name.getID() >= d_deferred.size())
+    {
+        if (!setting)
+            return;
+
+        d_deferred.resize(EventID::getInternedCount(), false);
+    }
+
+    d_deferred[name.getID()] = setting;
+}
+
+//----------------------------------------------------------------------------//
+void EventQueue::post(Window& window, const EventID& name,
+                      const EventID& event_namespace)
+{
+    const bool local = !window.isMuted();
+    const std::pair<EntrySet::iterator, bool> queued = d_queued.insert(
+        std::make_pair(std::make_pair(&window, name.getID()), d_queue.size()));
+
+    if (queued.second)
+        d_queue.push_back(Entry(window, name, event_namespace, local));
+    else if (local)
+        d_queue[queued.first->second].d_local = true;
+}
+
+//----------------------------------------------------------------------------//
+void EventQueue::cancel(const Window& window)
+{
+    if (d_queue.empty() && d_draining.empty())
+        return;
+
+    EntryList::iterator out = d_queue.begin();
+    for (EntryList::iterator in = d_queue.begin(); in != d_queue.end(); ++in)
+    {
+        const std::pair<const Window*, uint> key(in->d_window,
+                                                 in->d_name.getID());
+
+        if (in->d_window == &window)
+            d_queued.erase(key);
+        else
+        {
+            d_queued[key] = out - d_queue.begin();
+            *out++ = *in;
+        }
+    }
+    d_queue.erase(out, d_queue.end());
+
+    // the window may be destroyed while its events are being delivered.
+    for (size_t i = 0; i < d_draining.size(); ++i)
+        if (d_draining[i].d_window == &window)
+            d_draining[i].d_window = 0;
+}
+
+//----------------------------------------------------------------------------//
+size_t EventQueue::getQueuedCount() const
+{
+    return d_queue.size();
+}
+
+//----------------------------------------------------------------------------//
+uint EventQueue::drain()
+{
+    // a drain started by a handler leaves the work to the one in progress.
+    if (!d_draining.empty())
+        return 0;
+
+    uint fired = 0;
+
+    for (uint pass = 0; pass < s_maxPasses && !d_queue.empty(); ++pass)
+    {
+        // events queued by the handlers go into a fresh d_queue and are
+        // delivered by the next pass.
+        d_draining.swap(d_queue);
+        d_queued.clear();
+
+        for (size_t i = 0; i < d_draining.size(); ++i)
+        {
+            Window* const wnd = d_draining[i].d_window;
+            if (!wnd)
+                continue;
+
+            WindowEventArgs args(wnd);
+            wnd->fireEvent_impl(d_draining[i].d_name, args,
+                                d_draining[i].d_namespace,
+                                d_draining[i].d_local);
+            ++fired;
+        }
+
+        d_draining.clear();
+    }
+
+    return fired;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CEGUIBase.h"
+#include "CEGUIEventID.h"
+
+#include <map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Defers selected window events, coalesces them and delivers them once per
+    frame.
+
+    Events marked via setDeferred are not fired when a Window fires them;
+    instead the (window, event) pair is queued, and further fires of the same
+    event by the same window before delivery are dropped.  The System drains
+    the queue at the start of every renderGUI, so a bulk layout change - for
+    example a setArea that resizes a whole tree of child windows - calls each
+    handler of a deferred event at most once per window.
+
+    Like an event fired directly, a deferred event reaches the window's own
+    subscribers only if the window was not muted when it fired the event;
+    global subscribers get it either way.
+
+    Deferred events are delivered with a WindowEventArgs naming the window,
+    and the 'handled' count of the original EventArgs is not updated.  Only
+    events whose handlers need nothing more than that - such as
+    Window::EventSized, Window::EventMoved or Window::EventTextChanged -
+    should be deferred.  No events are deferred by default.
+*/
+class EventQueue
+{
+public:
+    //! Constructor.
+    EventQueue();
+
+    //! Set whether window events named \a name are deferred.
+    void setDeferred(const EventID& name, bool setting);
+
+    //! Return whether window events named \a name are deferred.
+    bool isDeferred(const EventID& name) const
+    {
+        return name.getID() < d_deferred.size() && d_deferred[name.getID()];
+    }
+
+    //! Queue the event \a name of \a window, unless it is already queued.
+    void post(Window& window, const EventID& name,
+              const EventID& event_namespace);
+
+    //! Remove all events queued for \a window.
+    void cancel(const Window& window);
+
+    //! Return the number of events waiting for delivery.
+    size_t getQueuedCount() const;
+
+    /*!
+    \brief
+        Fire all queued events, in the order they were first queued.  Deferred
+        events fired by the handlers are queued and delivered by the same
+        drain, in up to s_maxPasses passes; events still queued after that,
+        such as those of a handler that keeps firing its own event, are left
+        for the next drain.
+
+    \return
+        Number of events fired.
+    */
+    uint drain();
+
+    //! Most passes over the queue made by one drain.
+    static const uint s_maxPasses = 16;
+
+private:
+    struct Entry
+    {
+        Entry(Window& window, const EventID& name,
+              const EventID& event_namespace, bool local);
+
+        Window* d_window;
+        EventID d_name;
+        EventID d_namespace;
+        //! whether the window was unmuted when any fire of the event
+        //! was queued, so that its own subscribers get the event.
+        bool d_local;
+    };
+
+    typedef std::vector<Entry> EntryList;
+    //! index in d_queue of the event queued for each window and event id.
+    typedef std::map<std::pair<const Window*, uint>, size_t> EntrySet;
+
+    //! flags by event id of the deferred events.
+    std::vector<bool> d_deferred;
+    //! queued events, in order.
+    EntryList d_queue;
+    EntrySet d_queued;
+    //! events being delivered by drain; reused between drains.
+    EntryList d_draining;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
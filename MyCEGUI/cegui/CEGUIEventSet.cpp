@@ -1,4 +1,5 @@
 #include "CEGUIEventSet.h"
+#include "CEGUIEventTracer.h"
 #include "CEGUIExceptions.h"
 #include "CEGUIGlobalEventSet.h"
 #include "CEGUIScriptModule.h"
@@ -18,18 +19,28 @@ EventSet::~EventSet(void)
 }
 
 void EventSet::addEvent(const String& name)
+{
+	addEvent(EventID(name));
+}
+
+void EventSet::addEvent(const EventID& name)
 {
 	if (isEventPresent(name))
 	{
-		CEGUI_THROW(AlreadyExistsException("An event named '" + name + "' already exists in the EventSet."));
+		CEGUI_THROW(AlreadyExistsException("An event named '" + name.getName() + "' already exists in the EventSet."));
 	}
 
-	d_events[name] = new Event(name);
+	d_events[name.getID()] = new Event(name);
 }
 
 void EventSet::removeEvent(const String& name)
 {
-	EventMap::iterator pos = d_events.find(name);
+	removeEvent(EventID::find(name));
+}
+
+void EventSet::removeEvent(const EventID& name)
+{
+	EventMap::iterator pos = d_events.find(name.getID());
 
 	if (pos != d_events.end())
 	{
@@ -54,7 +65,12 @@ void EventSet::removeAllEvents(void)
 
 bool EventSet::isEventPresent(const String& name)
 {
-	return (d_events.find(name) != d_events.end());
+	return isEventPresent(EventID::find(name));
+}
+
+bool EventSet::isEventPresent(const EventID& name)
+{
+	return (d_events.find(name.getID()) != d_events.end());
 }
 
 
@@ -82,12 +98,22 @@ Event::Connection EventSet::subscribeScriptedEvent(const String& name, Event::Gr
 
 
 Event::Connection EventSet::subscribeEvent(const String& name, Event::Subscriber subscriber)
+{
+    return subscribeEvent(EventID(name), subscriber);
+}
+
+Event::Connection EventSet::subscribeEvent(const String& name, Event::Group group, Event::Subscriber subscriber)
+{
+    return subscribeEvent(EventID(name), group, subscriber);
+}
+
+Event::Connection EventSet::subscribeEvent(const EventID& name, Event::Subscriber subscriber)
 {
     // do subscription & return connection
     return getEventObject(name, true)->subscribe(subscriber);
 }
 
-Event::Connection EventSet::subscribeEvent(const String& name, Event::Group group, Event::Subscriber subscriber)
+Event::Connection EventSet::subscribeEvent(const EventID& name, Event::Group group, Event::Subscriber subscriber)
 {
     // do subscription with group & return connection
     return getEventObject(name, true)->subscribe(group, subscriber);
@@ -95,10 +121,16 @@ Event::Connection EventSet::subscribeEvent(const String& name, Event::Group grou
 
 void EventSet::fireEvent(const String& name, EventArgs& args, const String& eventNamespace)
 {
-    // handle global events
-    GlobalEventSet::getSingleton().fireEvent(name, args, eventNamespace);
-    // handle local event
-    fireEvent_impl(name, args);
+    // a name that was never interned has no event and no subscribers.
+    const EventID id(EventID::find(name));
+
+    if (id.isValid())
+        fireEvent(id, args, EventID::find(eventNamespace));
+}
+
+void EventSet::fireEvent(const EventID& name, EventArgs& args, const EventID& eventNamespace)
+{
+    fireEvent_impl(name, args, eventNamespace, !d_muted);
 }
 
 bool EventSet::isMuted(void) const
@@ -114,7 +146,13 @@ void EventSet::setMutedState(bool setting)
 
 Event* EventSet::getEventObject(const String& name, bool autoAdd)
 {
-    EventMap::iterator pos = d_events.find(name);
+    return getEventObject(autoAdd ? EventID(name) : EventID::find(name),
+                          autoAdd);
+}
+
+Event* EventSet::getEventObject(const EventID& name, bool autoAdd)
+{
+    EventMap::iterator pos = d_events.find(name.getID());
 
     // if event did not exist, add it and then find it.
     if (pos == d_events.end())
@@ -122,7 +160,7 @@ Event* EventSet::getEventObject(const String& name, bool autoAdd)
         if (autoAdd)
         {
             addEvent(name);
-            return d_events.find(name)->second;
+            return d_events.find(name.getID())->second;
         }
         else
         {
@@ -133,15 +171,64 @@ Event* EventSet::getEventObject(const String& name, bool autoAdd)
     return pos->second;
 }
 
+const Event* EventSet::getEventObject(const EventID& name) const
+{
+    EventMap::const_iterator pos = d_events.find(name.getID());
+
+    return (pos == d_events.end()) ? 0 : pos->second;
+}
+
 
 void EventSet::fireEvent_impl(const String& name, EventArgs& args)
 {
+    const EventID id(EventID::find(name));
+
+    if (id.isValid())
+        fireEvent_impl(id, args);
+}
+
+void EventSet::fireEvent_impl(const EventID& name, EventArgs& args)
+{
+    // nothing was ever subscribed or added to this set.
+    if (d_events.empty())
+        return;
+
     // find event object
     Event* ev = getEventObject(name);
 
     // fire the event if present and set is not muted
     if ((ev != 0) && !d_muted)
-        (*ev)(args);
+        dispatchEvent(*ev, args, name, false);
+}
+
+void EventSet::fireEvent_impl(const EventID& name, EventArgs& args,
+                              const EventID& eventNamespace, bool local)
+{
+    if (EventTracer* const tracer = EventTracer::getActive())
+        tracer->recordFire(name);
+
+    // handle global events, unless no global subscriber exists for the event
+    GlobalEventSet& global_events = GlobalEventSet::getSingleton();
+    if (global_events.isSubscribed(name))
+        global_events.fireEvent(name, args, eventNamespace);
+
+    // handle local event
+    if (!local || d_events.empty())
+        return;
+
+    if (Event* const ev = getEventObject(name))
+        dispatchEvent(*ev, args, name, false);
+}
+
+void EventSet::dispatchEvent(Event& ev, EventArgs& args, const EventID& name, bool global)
+{
+    if (EventTracer* const tracer = EventTracer::getActive())
+    {
+        EventTracer::Context context(*tracer, name, global);
+        ev(args);
+    }
+    else
+        ev(args);
 }
 
 EventSet::Iterator EventSet::getIterator(void) const
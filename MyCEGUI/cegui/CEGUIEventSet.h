@@ -3,6 +3,7 @@
 #include "CEGUIBase.h"
 #include "CEGUIString.h"
 #include "CEGUIEvent.h"
+#include "CEGUIEventID.h"
 #include "CEGUIIteratorBase.h"
 #include <map>
 
@@ -17,25 +18,45 @@ public:
 	virtual ~EventSet(void);
 	//exception AlreadyExistsException	Thrown if an Event already exists named \a name.
 	void	addEvent(const String& name);
+	void	addEvent(const EventID& name);
 	void	removeEvent(const String& name);
-	void	removeAllEvents(void);
+	virtual void	removeEvent(const EventID& name);
+	virtual void	removeAllEvents(void);
 	bool	isEventPresent(const String& name);
+	bool	isEventPresent(const EventID& name);
 	//virtualͣ¼עľEventִ
     virtual Event::Connection subscribeEvent(const String& name, Event::Subscriber subscriber);
     virtual Event::Connection subscribeEvent(const String& name, Event::Group group, Event::Subscriber subscriber);
+    //! Subscribe by interned event name; the String versions forward to these.
+    virtual Event::Connection subscribeEvent(const EventID& name, Event::Subscriber subscriber);
+    virtual Event::Connection subscribeEvent(const EventID& name, Event::Group group, Event::Subscriber subscriber);
     virtual Event::Connection subscribeScriptedEvent(const String& name, const String& subscriber_name);
     virtual Event::Connection subscribeScriptedEvent(const String& name, Event::Group group, const String& subscriber_name);
     virtual void fireEvent(const String& name, EventArgs& args, const String& eventNamespace = "");
+    //! Fire by interned event name and namespace; the String version forwards to this.
+    //! Names held in other forms can be passed as EventID::find(name).
+    virtual void fireEvent(const EventID& name, EventArgs& args, const EventID& eventNamespace);
 	bool	isMuted(void) const;
 	void	setMutedState(bool setting);
 protected:
     Event* getEventObject(const String& name, bool autoAdd = false);
+    Event* getEventObject(const EventID& name, bool autoAdd = false);
+    //! Return the Event named \a name, or 0 if there is no such Event.
+    const Event* getEventObject(const EventID& name) const;
     void fireEvent_impl(const String& name, EventArgs& args);
+    void fireEvent_impl(const EventID& name, EventArgs& args);
+    //! fire \a name to the global subscribers and, if \a local is true, to
+    //! the subscribers of this set whether or not it is muted.
+    void fireEvent_impl(const EventID& name, EventArgs& args,
+                        const EventID& eventNamespace, bool local);
+    //! notify the subscribers of \a ev, tracing it as the event \a name.
+    void dispatchEvent(Event& ev, EventArgs& args, const EventID& name, bool global);
 	// Do not allow copying, assignment, or any other usage than simple creation.
 	EventSet(EventSet&) {}
 	EventSet& operator=(EventSet&) {return *this;}
 
-	typedef std::map<String, Event*, String::FastLessCompare>	EventMap;
+	//! events keyed by EventID::getID of their name.
+	typedef std::map<uint, Event*>	EventMap;
 	EventMap	d_events;
 
 	bool	d_muted;	//!< true if events for this EventSet have been muted.
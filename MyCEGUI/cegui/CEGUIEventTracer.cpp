@@ -0,0 +1,296 @@
+#include "CEGUIEventTracer.h"
+#include "CEGUISubscriberSlot.h"
+#include "CEGUIExceptions.h"
+#include "CEGUIClock.h"
+
+#include <algorithm>
+#include <fstream>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+EventTracer* EventTracer::s_active = 0;
+
+//----------------------------------------------------------------------------//
+// write \a str to \a out as a JSON string literal.
+static void writeJSONString(std::ostream& out, const char* str)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    out << '"';
+    for (const unsigned char* c = reinterpret_cast<const unsigned char*>(str);
+         *c; ++c)
+    {
+        switch (*c)
+        {
+        case '"':  out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\r': out << "\\r"; break;
+        case '\t': out << "\\t"; break;
+        default:
+            if (*c < 0x20)
+                out << "\\u00" << hex[*c >> 4] << hex[*c & 0xF];
+            else
+                out << *c;
+        }
+    }
+    out << '"';
+}
+
+//----------------------------------------------------------------------------//
+// orders EventStats by descending total handler time.
+static bool hotterThan(const EventTracer::EventStats& a,
+                       const EventTracer::EventStats& b)
+{
+    return a.d_localHandlerTime + a.d_globalHandlerTime >
+           b.d_localHandlerTime + b.d_globalHandlerTime;
+}
+
+//----------------------------------------------------------------------------//
+EventTracer::Context::Context(EventTracer& tracer, const EventID& name,
+                              bool global) :
+    d_tracer(tracer),
+    d_previousID(tracer.d_contextID),
+    d_previousGlobal(tracer.d_contextGlobal)
+{
+    tracer.d_contextID = name.getID();
+    tracer.d_contextGlobal = global;
+
+    EventStats* const stats[] = { &getStats(tracer.d_totals, name.getID()),
+                                  &getStats(tracer.d_frame, name.getID()) };
+    for (int i = 0; i < 2; ++i)
+    {
+        if (global)
+            ++stats[i]->d_globalDispatchCount;
+        else
+            ++stats[i]->d_localDispatchCount;
+    }
+}
+
+//----------------------------------------------------------------------------//
+EventTracer::Context::~Context()
+{
+    d_tracer.d_contextID = d_previousID;
+    d_tracer.d_contextGlobal = d_previousGlobal;
+}
+
+//----------------------------------------------------------------------------//
+EventTracer::EventTracer() :
+    d_frameCount(0),
+    d_contextID(NoContext),
+    d_contextGlobal(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+EventTracer::~EventTracer()
+{
+    if (s_active == this)
+        s_active = 0;
+}
+
+//----------------------------------------------------------------------------//
+void EventTracer::setEnabled(bool setting)
+{
+    if (setting)
+        s_active = this;
+    else if (s_active == this)
+        s_active = 0;
+}
+
+//----------------------------------------------------------------------------//
+void EventTracer::reset()
+{
+    d_frameCount = 0;
+    d_totals.clear();
+    d_frame.clear();
+    d_lastFrame.clear();
+}
+
+//----------------------------------------------------------------------------//
+EventTracer::EventStatsList EventTracer::getTotalStats() const
+{
+    return collect(d_totals);
+}
+
+//----------------------------------------------------------------------------//
+void EventTracer::writeCSV(const String& filename, bool last_frame) const
+{
+    std::ofstream out(filename.c_str(),
+                      std::ios_base::out | std::ios_base::trunc);
+
+    if (!out)
+        CEGUI_THROW(FileIOException("EventTracer::writeCSV - "
+            "Failed to open file '" + filename + "' for writing."));
+
+    const EventStatsList stats(last_frame ? d_lastFrame : getTotalStats());
+
+    out.setf(std::ios_base::fixed, std::ios_base::floatfield);
+    out.precision(3);
+
+    out << "event,fires,local_dispatches,global_dispatches,handlers,handled,"
+           "local_handler_us,global_handler_us\n";
+
+    for (size_t i = 0; i < stats.size(); ++i)
+    {
+        const EventStats& s = stats[i];
+
+        // event names are quoted, with any quote doubled.
+        out << '"';
+        for (const char* c = s.d_name.c_str(); *c; ++c)
+        {
+            if (*c == '"')
+                out << '"';
+            out << *c;
+        }
+        out << '"';
+
+        out << ',' << s.d_fireCount
+            << ',' << s.d_localDispatchCount
+            << ',' << s.d_globalDispatchCount
+            << ',' << s.d_handlerCount
+            << ',' << s.d_handledCount
+            << ',' << s.d_localHandlerTime
+            << ',' << s.d_globalHandlerTime << '\n';
+    }
+
+    if (!out)
+        CEGUI_THROW(FileIOException("EventTracer::writeCSV - "
+            "Failed to write file '" + filename + "'."));
+}
+
+//----------------------------------------------------------------------------//
+void EventTracer::writeJSON(const String& filename, bool last_frame) const
+{
+    std::ofstream out(filename.c_str(),
+                      std::ios_base::out | std::ios_base::trunc);
+
+    if (!out)
+        CEGUI_THROW(FileIOException("EventTracer::writeJSON - "
+            "Failed to open file '" + filename + "' for writing."));
+
+    const EventStatsList stats(last_frame ? d_lastFrame : getTotalStats());
+
+    out.setf(std::ios_base::fixed, std::ios_base::floatfield);
+    out.precision(3);
+
+    out << "{\"frames\":" << (last_frame ? 1 : d_frameCount)
+        << ",\"events\":[";
+
+    for (size_t i = 0; i < stats.size(); ++i)
+    {
+        const EventStats& s = stats[i];
+
+        out << (i ? ",\n" : "\n") << "{\"name\":";
+        writeJSONString(out, s.d_name.c_str());
+        out << ",\"fires\":" << s.d_fireCount
+            << ",\"localDispatches\":" << s.d_localDispatchCount
+            << ",\"globalDispatches\":" << s.d_globalDispatchCount
+            << ",\"handlers\":" << s.d_handlerCount
+            << ",\"handled\":" << s.d_handledCount
+            << ",\"localHandlerTime\":" << s.d_localHandlerTime
+            << ",\"globalHandlerTime\":" << s.d_globalHandlerTime << '}';
+    }
+
+    out << "\n]}\n";
+
+    if (!out)
+        CEGUI_THROW(FileIOException("EventTracer::writeJSON - "
+            "Failed to write file '" + filename + "'."));
+}
+
+//----------------------------------------------------------------------------//
+void EventTracer::recordFire(const EventID& name)
+{
+    ++getStats(d_totals, name.getID()).d_fireCount;
+    ++getStats(d_frame, name.getID()).d_fireCount;
+}
+
+//----------------------------------------------------------------------------//
+bool EventTracer::invoke(const SubscriberSlot& subscriber, EventArgs& args)
+{
+    // handlers called other than via an EventSet are not attributed.
+    if (d_contextID == NoContext)
+        return subscriber(args);
+
+    const uint64 start = Clock::getTime();
+    const bool handled = subscriber(args);
+    const double time = Clock::toSeconds(start, Clock::getTime()) * 1e6;
+
+    EventStats* const stats[] = { &getStats(d_totals, d_contextID),
+                                  &getStats(d_frame, d_contextID) };
+    for (int i = 0; i < 2; ++i)
+    {
+        ++stats[i]->d_handlerCount;
+        if (handled)
+            ++stats[i]->d_handledCount;
+
+        if (d_contextGlobal)
+            stats[i]->d_globalHandlerTime += time;
+        else
+            stats[i]->d_localHandlerTime += time;
+    }
+
+    return handled;
+}
+
+//----------------------------------------------------------------------------//
+void EventTracer::endFrame()
+{
+    d_lastFrame = collect(d_frame);
+
+    for (size_t i = 0; i < d_frame.size(); ++i)
+    {
+        EventStats& s = d_frame[i];
+        s.d_fireCount = s.d_localDispatchCount = s.d_globalDispatchCount = 0;
+        s.d_handlerCount = s.d_handledCount = 0;
+        s.d_localHandlerTime = s.d_globalHandlerTime = 0;
+    }
+
+    ++d_frameCount;
+}
+
+//----------------------------------------------------------------------------//
+EventTracer::EventStats& EventTracer::getStats(EventStatsList& stats, uint id)
+{
+    if (id >= stats.size())
+    {
+        EventStats unused;
+        unused.d_fireCount = 0;
+        unused.d_localDispatchCount = 0;
+        unused.d_globalDispatchCount = 0;
+        unused.d_handlerCount = 0;
+        unused.d_handledCount = 0;
+        unused.d_localHandlerTime = 0;
+        unused.d_globalHandlerTime = 0;
+
+        stats.resize(id + 1, unused);
+    }
+
+    EventStats& s = stats[id];
+    if (s.d_name.empty())
+        s.d_name = EventID::getNameForID(id);
+
+    return s;
+}
+
+//----------------------------------------------------------------------------//
+EventTracer::EventStatsList EventTracer::collect(const EventStatsList& stats)
+{
+    EventStatsList used;
+
+    for (size_t i = 0; i < stats.size(); ++i)
+        if (stats[i].d_fireCount || stats[i].d_localDispatchCount ||
+            stats[i].d_globalDispatchCount)
+            used.push_back(stats[i]);
+
+    std::stable_sort(used.begin(), used.end(), hotterThan);
+
+    return used;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "CEGUIBase.h"
+#include "CEGUIString.h"
+#include "CEGUIEventID.h"
+
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class SubscriberSlot;
+class EventArgs;
+
+/*!
+\brief
+    Opt-in statistics on event dispatch.
+
+    While enabled, the tracer counts for each event name how often it was
+    fired, how often it was dispatched to the local subscribers of the
+    firing EventSet and to global subscribers via the GlobalEventSet, how
+    many handlers were called, how many of them reported the event handled
+    and how much time those handlers took.  Handler times are inclusive: a
+    handler that fires further events is also charged for their handlers.
+
+    Statistics are kept both in total and for the most recent frame, which
+    the System ends at the end of each renderGUI.  They can be inspected via
+    getFrameStats and getTotalStats, or written to a file with writeCSV or
+    writeJSON.
+
+    The System owns the tracer, see System::getEventTracer.  When the tracer
+    is disabled, the instrumented functions only test getActive.
+*/
+class EventTracer
+{
+public:
+    //! Statistics for one event name.  Times are in microseconds.
+    struct EventStats
+    {
+        //! name of the event, without any event namespace.
+        String d_name;
+        //! number of times the event was fired.
+        uint d_fireCount;
+        //! number of times local subscribers were notified.
+        uint d_localDispatchCount;
+        //! number of times global subscribers were notified.
+        uint d_globalDispatchCount;
+        //! number of handlers called.
+        uint d_handlerCount;
+        //! number of handlers that reported the event handled.
+        uint d_handledCount;
+        //! time spent in local handlers.
+        double d_localHandlerTime;
+        //! time spent in global handlers.
+        double d_globalHandlerTime;
+    };
+
+    typedef std::vector<EventStats> EventStatsList;
+
+    /*!
+    \brief
+        Sets up the tracer to record the handlers called by an Event, for as
+        long as the Context exists.  Used by the instrumented code.
+    */
+    class Context
+    {
+    public:
+        Context(EventTracer& tracer, const EventID& name, bool global);
+        ~Context();
+
+    private:
+        Context(const Context&);
+        Context& operator=(const Context&);
+
+        EventTracer& d_tracer;
+        //! context in effect before this one.
+        uint d_previousID;
+        bool d_previousGlobal;
+    };
+
+    //! Constructor.  The tracer is initially disabled.
+    EventTracer();
+
+    //! Destructor.
+    ~EventTracer();
+
+    //! Enable or disable tracing.  Disabling keeps the recorded statistics.
+    void setEnabled(bool setting);
+
+    //! Return whether tracing is enabled.
+    bool isEnabled() const {return s_active == this;}
+
+    //! Discard all statistics recorded so far.
+    void reset();
+
+    /*!
+    \brief
+        Return the statistics of the events that were fired during the most
+        recent frame, by descending total handler time.
+    */
+    const EventStatsList& getFrameStats() const {return d_lastFrame;}
+
+    /*!
+    \brief
+        Return the statistics of all events fired since tracing was enabled
+        or last reset, by descending total handler time.
+    */
+    EventStatsList getTotalStats() const;
+
+    //! Return the number of frames recorded.
+    uint getFrameCount() const {return d_frameCount;}
+
+    /*!
+    \brief
+        Write the statistics to \a filename as comma separated values, with
+        a header row and one row per event.
+
+    \param last_frame
+        true to write the statistics of the most recent frame, false to write
+        the totals.
+
+    \exception FileIOException
+        thrown if the file could not be written.
+    */
+    void writeCSV(const String& filename, bool last_frame = false) const;
+
+    /*!
+    \brief
+        Write the statistics to \a filename as a JSON object.
+
+    \param last_frame
+        true to write the statistics of the most recent frame, false to write
+        the totals.
+
+    \exception FileIOException
+        thrown if the file could not be written.
+    */
+    void writeJSON(const String& filename, bool last_frame = false) const;
+
+    //! Return the enabled tracer, or 0 if tracing is disabled.
+    static EventTracer* getActive() {return s_active;}
+
+    // functions called by the instrumented code.
+
+    //! record that the event \a name was fired.
+    void recordFire(const EventID& name);
+
+    /*!
+    \brief
+        call \a subscriber with \a args, recording the call for the event of
+        the current Context.  Returns what the subscriber returned.
+    */
+    bool invoke(const SubscriberSlot& subscriber, EventArgs& args);
+
+    //! called by System::renderGUI once a frame is complete.
+    void endFrame();
+
+private:
+    //! no context is in effect.
+    static const uint NoContext = static_cast<uint>(-1);
+
+    //! return the entry for the event with id \a id in \a stats.
+    static EventStats& getStats(EventStatsList& stats, uint id);
+    //! return the used entries of \a stats, by descending handler time.
+    static EventStatsList collect(const EventStatsList& stats);
+
+    static EventTracer* s_active;
+
+    uint d_frameCount;
+    //! totals, indexed by event id.
+    EventStatsList d_totals;
+    //! the frame being recorded, indexed by event id.
+    EventStatsList d_frame;
+    //! the most recent complete frame, see getFrameStats.
+    EventStatsList d_lastFrame;
+    //! event the handlers now being called belong to.
+    uint d_contextID;
+    //! true if the handlers now being called are global subscribers.
+    bool d_contextGlobal;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
@@ -29,6 +29,7 @@ class FontGlyph;
 class FontManager;
 class FormattedRenderedString;
 class GeometryBuffer;
+struct GeometryQuad;
 class GlobalEventSet;
 class Image;
 class ImageCodec;
@@ -62,6 +63,7 @@ class RenderingRoot;
 class RenderingSurface;
 class RenderingWindow;
 class RenderQueue;
+struct RenderStatistics;
 class RenderSystem;
 class RenderTarget;
 class ResourceEventSet;
@@ -2,6 +2,8 @@
 
 #include "CEGUISlotFunctorBase.h"
 
+#include <new>
+
 namespace CEGUI
 {
 
@@ -20,6 +22,11 @@ public:
 		return d_function(args);
 	}
 
+	virtual SlotFunctorBase* copyTo(void* buffer) const
+	{
+		return new (buffer) FreeFunctionSlot(*this);
+	}
+
 private:
 	SlotFunction* d_function;
 };
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "CEGUISlotFunctorBase.h"
+
+#include <new>
+
 namespace CEGUI
 {
 
@@ -16,6 +20,11 @@ public:
         return (*d_functor)(args);
     }
 
+    virtual SlotFunctorBase* copyTo(void* buffer) const
+    {
+        return new (buffer) FunctorPointerSlot(*this);
+    }
+
 private:
     T* d_functor;
 };
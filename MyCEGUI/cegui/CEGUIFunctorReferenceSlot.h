@@ -2,6 +2,8 @@
 
 #include "CEGUISlotFunctorBase.h"
 
+#include <new>
+
 namespace CEGUI
 {
 
@@ -18,6 +20,11 @@ public:
         return d_functor(args);
     }
 
+    virtual SlotFunctorBase* copyTo(void* buffer) const
+    {
+        return new (buffer) FunctorReferenceSlot(*this);
+    }
+
 private:
     T& d_functor;
 };
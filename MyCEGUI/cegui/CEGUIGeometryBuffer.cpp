@@ -0,0 +1,135 @@
+#include "CEGUIGeometryBuffer.h"
+#include "CEGUIVertex.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const int GeometryBuffer::s_quadCorners[2][6] =
+{
+    // TopLeftToBottomRight
+    { QC_TOP_LEFT, QC_BOTTOM_LEFT, QC_BOTTOM_RIGHT,
+      QC_TOP_RIGHT, QC_TOP_LEFT, QC_BOTTOM_RIGHT },
+    // BottomLeftToTopRight
+    { QC_TOP_LEFT, QC_BOTTOM_LEFT, QC_TOP_RIGHT,
+      QC_TOP_RIGHT, QC_BOTTOM_LEFT, QC_BOTTOM_RIGHT }
+};
+
+//----------------------------------------------------------------------------//
+GeometryBuffer::GeometryBuffer() :
+    d_blendMode(BM_NORMAL),
+    d_clipRect(0, 0, 0, 0),
+    d_translation(0, 0, 0),
+    d_rotation(0, 0, 0),
+    d_pivot(0, 0, 0),
+    d_effect(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer::~GeometryBuffer()
+{
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBuffer::appendQuads(const GeometryQuad* const quads,
+                                 uint quad_count)
+{
+    Vertex corners[4];
+    Vertex vbuffer[6];
+
+    const GeometryQuad* q = quads;
+    for (uint i = 0; i < quad_count; ++i, ++q)
+    {
+        corners[QC_TOP_LEFT].position =
+            Vector3(q->position.d_left, q->position.d_top, q->z);
+        corners[QC_TOP_LEFT].tex_coords =
+            Vector2(q->tex_coords.d_left, q->tex_coords.d_top);
+        corners[QC_TOP_LEFT].colour_val = q->top_left;
+
+        corners[QC_TOP_RIGHT].position =
+            Vector3(q->position.d_right, q->position.d_top, q->z);
+        corners[QC_TOP_RIGHT].tex_coords =
+            Vector2(q->tex_coords.d_right, q->tex_coords.d_top);
+        corners[QC_TOP_RIGHT].colour_val = q->top_right;
+
+        corners[QC_BOTTOM_LEFT].position =
+            Vector3(q->position.d_left, q->position.d_bottom, q->z);
+        corners[QC_BOTTOM_LEFT].tex_coords =
+            Vector2(q->tex_coords.d_left, q->tex_coords.d_bottom);
+        corners[QC_BOTTOM_LEFT].colour_val = q->bottom_left;
+
+        corners[QC_BOTTOM_RIGHT].position =
+            Vector3(q->position.d_right, q->position.d_bottom, q->z);
+        corners[QC_BOTTOM_RIGHT].tex_coords =
+            Vector2(q->tex_coords.d_right, q->tex_coords.d_bottom);
+        corners[QC_BOTTOM_RIGHT].colour_val = q->bottom_right;
+
+        const int* const order =
+            s_quadCorners[q->split_mode == TopLeftToBottomRight ? 0 : 1];
+
+        for (int v = 0; v < 6; ++v)
+            vbuffer[v] = corners[order[v]];
+
+        appendGeometry(vbuffer, 6);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBuffer::setBlendMode(const BlendMode mode)
+{
+    d_blendMode = mode;
+}
+
+//----------------------------------------------------------------------------//
+BlendMode GeometryBuffer::getBlendMode() const
+{
+    return d_blendMode;
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::isMergeableWith(const GeometryBuffer& /*buffer*/) const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBuffer::appendMergedGeometry(const GeometryBuffer& /*buffer*/)
+{
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::isMergeCandidate() const
+{
+    return !d_effect && getVertexCount() &&
+           d_rotation == Vector3(0, 0, 0) && d_translation.d_z == 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryBuffer::isMergeCompatibleWith(const GeometryBuffer& buffer) const
+{
+    return isMergeCandidate() && buffer.isMergeCandidate() &&
+           d_blendMode == buffer.d_blendMode;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryBuffer::mergeStateOf(const GeometryBuffer& buffer)
+{
+    if (!getVertexCount())
+    {
+        d_blendMode = buffer.d_blendMode;
+        d_clipRect = buffer.d_clipRect;
+        return;
+    }
+
+    d_clipRect.d_left   = ceguimin(d_clipRect.d_left, buffer.d_clipRect.d_left);
+    d_clipRect.d_top    = ceguimin(d_clipRect.d_top, buffer.d_clipRect.d_top);
+    d_clipRect.d_right  = ceguimax(d_clipRect.d_right,
+                                   buffer.d_clipRect.d_right);
+    d_clipRect.d_bottom = ceguimax(d_clipRect.d_bottom,
+                                   buffer.d_clipRect.d_bottom);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,339 @@
+#pragma once
+
+#include "CEGUIBase.h"
+#include "CEGUIRenderer.h"
+#include "CEGUIRect.h"
+#include "CEGUIVector.h"
+#include "CEGUIcolour.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+
+/*!
+\brief
+    Compact description of an axis aligned, textured quad.
+
+    This is the unit of data accepted by GeometryBuffer::appendQuads.  A quad
+    holds only what is needed to generate its six vertices (the two triangles
+    of the quad), so producers such as Imageset::draw do not have to build
+    and copy complete Vertex objects, and renderers can convert the quad
+    straight into their own vertex format.
+*/
+struct GeometryQuad
+{
+    //! pixel area covered by the quad.
+    Rect position;
+    //! z co-ordinate shared by all four corners.
+    float z;
+    //! texture co-ordinates at the corners of \a position.
+    Rect tex_coords;
+    //! ARGB colour of the top-left corner.
+    argb_t top_left;
+    //! ARGB colour of the top-right corner.
+    argb_t top_right;
+    //! ARGB colour of the bottom-left corner.
+    argb_t bottom_left;
+    //! ARGB colour of the bottom-right corner.
+    argb_t bottom_right;
+    //! how the quad is to be split into two triangles.
+    QuadSplitMode split_mode;
+};
+
+//----------------------------------------------------------------------------//
+
+/*!
+\brief
+    Abstract class defining the interface for objects that buffer geometry for
+    later rendering.
+*/
+class GeometryBuffer
+{
+public:
+    //! Destructor
+    virtual ~GeometryBuffer();
+
+    /*!
+    \brief
+        Draw the geometry buffered within this GeometryBuffer object.
+    */
+    virtual void draw() const = 0;
+
+    /*!
+    \brief
+        Set the translation to be applied to the geometry in the buffer when it
+        is subsequently rendered.
+
+    \param v
+        Vector3 describing the three axis translation vector to be used.
+    */
+    virtual void setTranslation(const Vector3& v) = 0;
+
+    /*!
+    \brief
+        Set the rotations to be applied to the geometry in the buffer when it is
+        subsequently rendered.
+
+    \param r
+        Vector3 describing the rotation factors to be used.
+    */
+    virtual void setRotation(const Vector3& r) = 0;
+
+    /*!
+    \brief
+        Set the pivot point to be used when applying the rotations.
+
+    \param p
+        Vector3 describing the location of the pivot point to be used when
+        applying the rotation to the geometry.
+    */
+    virtual void setPivot(const Vector3& p) = 0;
+
+    /*!
+    \brief
+        Set the clipping region to be used when rendering this buffer.
+    */
+    virtual void setClippingRegion(const Rect& region) = 0;
+
+    /*!
+    \brief
+        Append a single vertex to the buffer.
+
+    \param vertex
+        Vertex object describing the vertex to be added to the GeometryBuffer.
+    */
+    virtual void appendVertex(const Vertex& vertex) = 0;
+
+    /*!
+    \brief
+        Append a number of vertices from an array to the GeometryBuffer.
+
+    \param vbuff
+        Pointer to an array of Vertex objects that describe the vertices that
+        are to be added to the GeometryBuffer.
+
+    \param vertex_count
+        The number of Vertex objects from the array \a vbuff that are to be
+        added to the GeometryBuffer.
+    */
+    virtual void appendGeometry(const Vertex* const vbuff,
+                                uint vertex_count) = 0;
+
+    /*!
+    \brief
+        Append a number of quads, as two triangles (six vertices) each, to the
+        GeometryBuffer.
+
+        All quads are added to the batch for the currently active texture.
+        Renderer implementations should override this to reserve space for
+        all of the new vertices at once and convert directly from the
+        GeometryQuad data; the default implementation expands the quads into
+        Vertex objects and passes them to appendGeometry.
+
+    \param quads
+        Pointer to an array of GeometryQuad objects describing the quads that
+        are to be added to the GeometryBuffer.
+
+    \param quad_count
+        The number of GeometryQuad objects from the array \a quads that are to
+        be added to the GeometryBuffer.
+    */
+    virtual void appendQuads(const GeometryQuad* const quads, uint quad_count);
+
+    /*!
+    \brief
+        Set the active texture to be used with all subsequently added vertices.
+
+    \param texture
+        Pointer to a Texture object that shall be used for subsequently added
+        vertices.  This may be 0, in which case texturing will be disabled for
+        subsequently added vertices.
+    */
+    virtual void setActiveTexture(Texture* texture) = 0;
+
+    /*!
+    \brief
+        Clear all buffered data and reset the GeometryBuffer to the default
+        state.
+    */
+    virtual void reset() = 0;
+
+    /*!
+    \brief
+        Return a pointer to the currently active Texture object.  This may
+        return 0 if no texture is set.
+
+    \return
+        Pointer the Texture object that is currently active, or 0 if texturing
+        is not being used.
+    */
+    virtual Texture* getActiveTexture() const = 0;
+
+    /*!
+    \brief
+        Return the total number of vertices currently held by this
+        GeometryBuffer object.
+
+    \return
+        The number of vertices that have been appended to this GeometryBuffer.
+    */
+    virtual uint getVertexCount() const = 0;
+
+    /*!
+    \brief
+        Return the number of batches of geometry that this GeometryBuffer has
+        split the vertices into.
+
+    \note
+        How batching is done will be largely implementation specific, although
+        it would be reasonable to expect that you will have <em>at least</em>
+        one batch of geometry per texture switch.
+
+    \return
+        The number of batches of geometry held by the GeometryBuffer.
+    */
+    virtual uint getBatchCount() const = 0;
+
+    /*!
+    \brief
+        Set the RenderEffect to be used by this GeometryBuffer.
+
+    \param effect
+        Pointer to the RenderEffect to be used during renderng of the
+        GeometryBuffer.  May be 0.
+    */
+    virtual void setRenderEffect(RenderEffect* effect) = 0;
+
+    /*!
+    \brief
+        Return the RenderEffect object that is assigned to this GeometryBuffer
+        or 0 if none.
+    */
+    virtual RenderEffect* getRenderEffect() = 0;
+
+    /*!
+    \brief
+        Set the blend mode option to use when rendering this GeometryBuffer.
+
+    \note
+        The blend mode setting is not a 'state' setting, but is used for \e all
+        geometry added to the buffer regardless of when the blend mode is set.
+
+    \param mode
+        One of the BlendMode enumerated values indicating the blending mode to
+        be used.
+    */
+    virtual void setBlendMode(const BlendMode mode);
+
+    /*!
+    \brief
+        Return the blend mode that is set to be used for this GeometryBuffer.
+
+    \return
+        One of the BlendMode enumerated values indicating the blending mode
+        that will be used when rendering all geometry added to this
+        GeometryBuffer object.
+    */
+    virtual BlendMode getBlendMode() const;
+
+    /*!
+    \brief
+        Return whether the geometry of \a buffer may be drawn in the same draw
+        operation as the geometry of this GeometryBuffer when \a buffer
+        immediately follows this one in a RenderQueue.
+
+        The RenderQueue uses this to merge consecutive buffers - typically
+        those of several sibling windows - into a single buffer, replacing
+        their individual per-buffer state changes and draw calls with one.
+        Implementations should only return true when the result of drawing the
+        merged geometry, clipped on the CPU to each source buffer's clipping
+        region, is identical to drawing the buffers separately.  The default
+        implementation returns false.
+
+    \param buffer
+        GeometryBuffer that would be drawn immediately after this one.
+
+    \return
+        - true if the geometry of both buffers may be merged.
+        - false if the buffers must be drawn separately.
+    */
+    virtual bool isMergeableWith(const GeometryBuffer& buffer) const;
+
+    /*!
+    \brief
+        Append the geometry of \a buffer, with its translation and clipping
+        region applied, to this GeometryBuffer.
+
+        This is used by the RenderQueue to build a merged buffer from a run of
+        buffers for which isMergeableWith returned true; \a buffer will
+        always be of the same concrete type as this GeometryBuffer.  The
+        default implementation does nothing.
+
+    \param buffer
+        GeometryBuffer whose geometry is to be appended.
+    */
+    virtual void appendMergedGeometry(const GeometryBuffer& buffer);
+
+protected:
+    //! Constructor.
+    GeometryBuffer();
+
+    //! corners of a quad, as listed in s_quadCorners.
+    enum QuadCorner
+    {
+        QC_TOP_LEFT,
+        QC_TOP_RIGHT,
+        QC_BOTTOM_LEFT,
+        QC_BOTTOM_RIGHT
+    };
+
+    //! QuadCorner used for each of the six vertices of a quad, indexed by
+    //! QuadSplitMode.
+    static const int s_quadCorners[2][6];
+
+    /*!
+    \brief
+        Return whether this buffer's state allows it to be merged at all.
+
+        The translation can be applied to the vertices on the CPU as long as
+        there is no rotation and the geometry stays in the z = 0 plane.
+    */
+    bool isMergeCandidate() const;
+
+    /*!
+    \brief
+        Return whether the state of this buffer and of \a buffer allows the
+        geometry of \a buffer to be merged onto this buffer's.
+
+        Implementations of isMergeableWith add their own tests - such as
+        whether the batches being joined use the same texture - to this.
+    */
+    bool isMergeCompatibleWith(const GeometryBuffer& buffer) const;
+
+    /*!
+    \brief
+        Take on the state of \a buffer whose geometry is about to be merged
+        onto this buffer's by appendMergedGeometry.
+
+        The clipping region becomes the area covered by the clipping regions
+        of all of the merged buffers; the region of each buffer is applied to
+        its own vertices when they are appended.
+    */
+    void mergeStateOf(const GeometryBuffer& buffer);
+
+    //! The BlendMode to use when rendering this GeometryBuffer.
+    BlendMode d_blendMode;
+    //! rectangular clip region
+    Rect d_clipRect;
+    //! translation vector
+    Vector3 d_translation;
+    //! rotation vector
+    Vector3 d_rotation;
+    //! pivot point for rotation
+    Vector3 d_pivot;
+    //! RenderEffect that will be used by the GeometryBuffer
+    RenderEffect* d_effect;
+};
+
+} // End of  CEGUI namespace section
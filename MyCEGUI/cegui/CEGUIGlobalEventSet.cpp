@@ -38,7 +38,102 @@ GlobalEventSet*	GlobalEventSet::getSingletonPtr(void)
 *************************************************************************/
 void GlobalEventSet::fireEvent(const String& name, EventArgs& args, const String& eventNamespace)   //ȫ¼ͨ¼ֻǰ׺ͬ
 {
-    fireEvent_impl(eventNamespace + "/" + name, args);
+    // a name that was never interned has no subscribers.
+    const EventID id(EventID::find(name));
+
+    if (id.isValid())
+        fireEvent(id, args, EventID::find(eventNamespace));
+}
+
+void GlobalEventSet::fireEvent(const EventID& name, EventArgs& args, const EventID& eventNamespace)
+{
+    if (d_muted || name.getID() >= d_dispatchTable.size())
+        return;
+
+    const NamespaceTable& namespaces = d_dispatchTable[name.getID()];
+
+    for (NamespaceTable::const_iterator i = namespaces.begin();
+         i != namespaces.end(); ++i)
+    {
+        if (i->first == eventNamespace.getID())
+        {
+            // traced under the event name, not the namespaced global name.
+            dispatchEvent(*i->second, args, name, true);
+            return;
+        }
+    }
+}
+
+Event::Connection GlobalEventSet::subscribeEvent(const EventID& name, Event::Subscriber subscriber)
+{
+    const Event::Connection connection(
+        EventSet::subscribeEvent(name, subscriber));
+    addToDispatchTable(name);
+    return connection;
+}
+
+Event::Connection GlobalEventSet::subscribeEvent(const EventID& name, Event::Group group, Event::Subscriber subscriber)
+{
+    const Event::Connection connection(
+        EventSet::subscribeEvent(name, group, subscriber));
+    addToDispatchTable(name);
+    return connection;
+}
+
+void GlobalEventSet::removeEvent(const EventID& name)
+{
+    Event* const ev = getEventObject(name);
+
+    if (!ev)
+        return;
+
+    for (size_t i = 0; i < d_dispatchTable.size(); ++i)
+    {
+        NamespaceTable& namespaces = d_dispatchTable[i];
+
+        for (NamespaceTable::iterator j = namespaces.begin();
+             j != namespaces.end(); ++j)
+        {
+            if (j->second == ev)
+            {
+                namespaces.erase(j);
+                break;
+            }
+        }
+    }
+
+    EventSet::removeEvent(name);
+}
+
+void GlobalEventSet::removeAllEvents(void)
+{
+    d_dispatchTable.clear();
+    EventSet::removeAllEvents();
+}
+
+void GlobalEventSet::addToDispatchTable(const EventID& name)
+{
+    // split the global name into the namespace and event name it is fired
+    // with; a name without a namespace is fired with an empty namespace.
+    const String& global_name = name.getName();
+    const String::size_type pos = global_name.rfind('/');
+    const EventID event_namespace(pos == String::npos ?
+                                  String() : global_name.substr(0, pos));
+    const EventID event_name(pos == String::npos ?
+                             global_name : global_name.substr(pos + 1));
+
+    if (event_name.getID() >= d_dispatchTable.size())
+        d_dispatchTable.resize(EventID::getInternedCount());
+
+    NamespaceTable& namespaces = d_dispatchTable[event_name.getID()];
+
+    for (NamespaceTable::const_iterator i = namespaces.begin();
+         i != namespaces.end(); ++i)
+        if (i->first == event_namespace.getID())
+            return;
+
+    namespaces.push_back(
+        std::make_pair(event_namespace.getID(), getEventObject(name)));
 }
 
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "CEGUIEventSet.h"
 #include "CEGUISingleton.h"
+#include <vector>
 
 namespace CEGUI
 {
@@ -20,6 +21,46 @@ public:
 	static	GlobalEventSet&	getSingleton(void);
 	static	GlobalEventSet*	getSingletonPtr(void);
 	virtual void	fireEvent(const String& name, EventArgs& args, const String& eventNamespace = "");
+	virtual void	fireEvent(const EventID& name, EventArgs& args, const EventID& eventNamespace);
+
+    using EventSet::subscribeEvent;
+    // overridden to enter the event into the dispatch table.
+    virtual Event::Connection subscribeEvent(const EventID& name, Event::Subscriber subscriber);
+    virtual Event::Connection subscribeEvent(const EventID& name, Event::Group group, Event::Subscriber subscriber);
+
+    using EventSet::removeEvent;
+    // overridden to drop the event from the dispatch table.
+    virtual void removeEvent(const EventID& name);
+    virtual void removeAllEvents(void);
+
+    /*!
+    \brief
+        Return whether a global subscription has ever been made to the event
+        \a name, in any event namespace.  EventSet::fireEvent skips the
+        GlobalEventSet entirely when this is false, so events nobody listens
+        to globally cost no lookup at all.
+    */
+    bool isSubscribed(const EventID& name) const
+    {
+        return name.getID() < d_dispatchTable.size() &&
+               !d_dispatchTable[name.getID()].empty();
+    }
+
+private:
+    //! the global Event of each event namespace id; usually only a few.
+    typedef std::vector<std::pair<uint, Event*> > NamespaceTable;
+
+    //! enter the Event for \a name - a "namespace/event" name - in the table.
+    void addToDispatchTable(const EventID& name);
+
+    /*!
+    \brief
+        Global events with subscribers, by the id of the event name and then
+        by the id of the event namespace.  Resolved when subscribing, so that
+        firing neither builds the "namespace/event" name nor searches
+        d_events.
+    */
+    std::vector<NamespaceTable> d_dispatchTable;
 };
 
 }
\ No newline at end of file
@@ -91,6 +91,21 @@ void Image::draw(GeometryBuffer& buffer, const Rect& dest_rect,
 }
 
 
+/*************************************************************************
+    Clip the image and build the quad that draw would queue.
+*************************************************************************/
+bool Image::makeQuad(GeometryQuad& quad, const Rect& dest_rect,
+    const Rect* clip_rect, const ColourRect& colours,
+    QuadSplitMode quad_split_mode) const
+{
+    Rect dest(dest_rect);
+    dest.offset(d_scaledOffset);
+
+    return d_owner->makeQuad(quad, d_area, dest, clip_rect, colours,
+                             quad_split_mode);
+}
+
+
 /*************************************************************************
 	String object containing the name of this Image	
 *************************************************************************/
@@ -435,6 +435,23 @@ public:
               const Rect* clip_rect, const ColourRect& colours,
               QuadSplitMode quad_split_mode = TopLeftToBottomRight) const;
 
+    /*!
+    \brief
+        Fill \a quad with the geometry that draw would queue for the Image.
+
+        Callers drawing many Images of one Imageset - such as the glyphs of
+        a string - collect the quads and queue them with one
+        GeometryBuffer::appendQuads call, after setting the Imageset's
+        texture active on the buffer.
+
+    \return
+        false if the Image is clipped away entirely, in which case \a quad
+        is left unchanged.
+    */
+    bool makeQuad(GeometryQuad& quad, const Rect& dest_rect,
+                  const Rect* clip_rect, const ColourRect& colours,
+                  QuadSplitMode quad_split_mode = TopLeftToBottomRight) const;
+
     /*!
     \brief
         Writes an xml representation of this Image object to \a out_stream.
@@ -10,7 +10,6 @@
 #include "CEGUIXMLSerializer.h"
 #include "CEGUIPropertyHelper.h"
 #include "CEGUIGeometryBuffer.h"
-#include "CEGUIVertex.h"
 #include <iostream>
 #include <cmath>
 
@@ -135,13 +134,32 @@ void Imageset::defineImage(const String& name, const Rect& image_rect, const Poi
 void Imageset::draw(GeometryBuffer& buffer, const Rect& source_rect,
     const Rect& dest_rect, const Rect* clip_rect,const ColourRect& colours,
     QuadSplitMode quad_split_mode) const
+{
+    GeometryQuad quad;
+
+    if (!makeQuad(quad, source_rect, dest_rect, clip_rect, colours,
+                  quad_split_mode))
+        return;
+
+    // TODO: Remove cast when GeometryBuffer gets it's APIs fixed!
+    buffer.setActiveTexture((Texture*)d_texture);
+    buffer.appendQuads(&quad, 1);
+}
+
+/*************************************************************************
+    Clips an area of the associated Texture and builds the quad that draw
+    would queue for it.
+*************************************************************************/
+bool Imageset::makeQuad(GeometryQuad& quad, const Rect& source_rect,
+    const Rect& dest_rect, const Rect* clip_rect, const ColourRect& colours,
+    QuadSplitMode quad_split_mode) const
 {
     // get the rect area that we will actually draw to (i.e. perform clipping)
     Rect final_rect(clip_rect ? dest_rect.getIntersection(*clip_rect) : dest_rect );
 
     // check if rect was totally clipped
     if ((final_rect.getWidth() == 0) || (final_rect.getHeight() == 0))
-        return;
+        return false;
 
     // Fix bug #45
     // Obtain correct scale values from the texture
@@ -162,69 +180,16 @@ void Imageset::draw(GeometryBuffer& buffer, const Rect& source_rect,
     final_rect.d_top	= PixelAligned(final_rect.d_top);
     final_rect.d_bottom	= PixelAligned(final_rect.d_bottom);
 
-    Vertex vbuffer[6];
-
-    // vertex 0
-    vbuffer[0].position   = Vector3(final_rect.d_left, final_rect.d_top, 0.0f);
-    vbuffer[0].colour_val = colours.d_top_left;
-    vbuffer[0].tex_coords = Vector2(tex_rect.d_left, tex_rect.d_top);
-
-    // vertex 1
-    vbuffer[1].position   = Vector3(final_rect.d_left, final_rect.d_bottom, 0.0f);
-    vbuffer[1].colour_val = colours.d_bottom_left;
-    vbuffer[1].tex_coords = Vector2(tex_rect.d_left, tex_rect.d_bottom);
-
-    // vertex 2
-    vbuffer[2].position.d_x   = final_rect.d_right;
-    vbuffer[2].position.d_z   = 0.0f;
-    vbuffer[2].colour_val     = colours.d_bottom_right;
-    vbuffer[2].tex_coords.d_x = tex_rect.d_right;
+    quad.position     = final_rect;
+    quad.z            = 0.0f;
+    quad.tex_coords   = tex_rect;
+    quad.top_left     = colours.d_top_left.getARGB();
+    quad.top_right    = colours.d_top_right.getARGB();
+    quad.bottom_left  = colours.d_bottom_left.getARGB();
+    quad.bottom_right = colours.d_bottom_right.getARGB();
+    quad.split_mode   = quad_split_mode;
 
-    // top-left to bottom-right diagonal
-    if (quad_split_mode == TopLeftToBottomRight)
-    {
-        vbuffer[2].position.d_y   = final_rect.d_bottom;
-        vbuffer[2].tex_coords.d_y = tex_rect.d_bottom;
-    }
-    // bottom-left to top-right diagonal
-    else
-    {
-        vbuffer[2].position.d_y   = final_rect.d_top;
-        vbuffer[2].tex_coords.d_y = tex_rect.d_top;
-    }
-
-    // vertex 3
-    vbuffer[3].position   = Vector3(final_rect.d_right, final_rect.d_top, 0.0f);
-    vbuffer[3].colour_val = colours.d_top_right;
-    vbuffer[3].tex_coords = Vector2(tex_rect.d_right, tex_rect.d_top);
-
-    // vertex 4
-    vbuffer[4].position.d_x   = final_rect.d_left;
-    vbuffer[4].position.d_z   = 0.0f;
-    vbuffer[4].colour_val     = colours.d_top_left;
-    vbuffer[4].tex_coords.d_x = tex_rect.d_left;
-
-    // top-left to bottom-right diagonal
-    if (quad_split_mode == TopLeftToBottomRight)
-    {
-        vbuffer[4].position.d_y   = final_rect.d_top;
-        vbuffer[4].tex_coords.d_y = tex_rect.d_top;
-    }
-    // bottom-left to top-right diagonal
-    else
-    {
-        vbuffer[4].position.d_y   = final_rect.d_bottom;
-        vbuffer[4].tex_coords.d_y = tex_rect.d_bottom;
-    }
-
-    // vertex 5
-    vbuffer[5].position = Vector3(final_rect.d_right, final_rect.d_bottom, 0.0f);
-    vbuffer[5].colour_val= colours.d_bottom_right;
-    vbuffer[5].tex_coords = Vector2(tex_rect.d_right, tex_rect.d_bottom);
-
-    // TODO: Remove cast when GeometryBuffer gets it's APIs fixed!
-    buffer.setActiveTexture((Texture*)d_texture);
-    buffer.appendGeometry(vbuffer, 6);
+    return true;
 }
 
 /*************************************************************************
@@ -217,6 +217,20 @@ public:
               const Rect& dest_rect, const Rect* clip_rect,
               const ColourRect& colours, QuadSplitMode quad_split_mode) const;
 
+    /*!
+    \brief
+        Fill \a quad with the geometry that draw would queue for the given
+        area, without queueing it; see Image::makeQuad.
+
+    \return
+        false if the area is clipped away entirely, in which case \a quad
+        is left unchanged.
+    */
+    bool makeQuad(GeometryQuad& quad, const Rect& source_rect,
+                  const Rect& dest_rect, const Rect* clip_rect,
+                  const ColourRect& colours,
+                  QuadSplitMode quad_split_mode) const;
+
     /*!
     \brief
         Queues an area of the associated Texture the be drawn on the screen.
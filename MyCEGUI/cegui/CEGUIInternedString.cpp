@@ -0,0 +1,171 @@
+#include "CEGUIInternedString.h"
+
+#include <vector>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Hash table of the pooled Strings, chained through Entry::d_next.
+class InternedString::Pool
+{
+public:
+    Pool() :
+        d_count(0),
+        d_buckets(64, static_cast<Entry*>(0))
+    {}
+
+    //! return the entry for \a str, or 0 if it is not pooled.
+    Entry* find(const StringView& str, size_t hash) const
+    {
+        for (Entry* e = d_buckets[hash & (d_buckets.size() - 1)]; e;
+             e = e->d_next)
+        {
+            if (e->d_hash == hash && StringView(e->d_string) == str)
+                return e;
+        }
+
+        return 0;
+    }
+
+    //! add \a str, which is not pooled, and return its entry.
+    Entry* add(const String& str, size_t hash)
+    {
+        // keep the load factor at most 1.
+        if (d_count >= d_buckets.size())
+            rehash(d_buckets.size() * 2);
+
+        Entry* const e = new Entry;
+        e->d_string = str;
+        e->d_hash = hash;
+        e->d_refCount = 0;
+
+        Entry*& bucket = d_buckets[hash & (d_buckets.size() - 1)];
+        e->d_next = bucket;
+        bucket = e;
+        ++d_count;
+
+        return e;
+    }
+
+    //! remove and delete \a entry.
+    void remove(Entry* entry)
+    {
+        Entry** link = &d_buckets[entry->d_hash & (d_buckets.size() - 1)];
+
+        while (*link != entry)
+            link = &(*link)->d_next;
+
+        *link = entry->d_next;
+        --d_count;
+
+        delete entry;
+    }
+
+    size_t getCount() const
+    {
+        return d_count;
+    }
+
+private:
+    void rehash(size_t bucket_count)
+    {
+        std::vector<Entry*> buckets(bucket_count, static_cast<Entry*>(0));
+
+        for (size_t i = 0; i < d_buckets.size(); ++i)
+        {
+            Entry* e = d_buckets[i];
+
+            while (e)
+            {
+                Entry* const next = e->d_next;
+                Entry*& bucket = buckets[e->d_hash & (bucket_count - 1)];
+                e->d_next = bucket;
+                bucket = e;
+                e = next;
+            }
+        }
+
+        d_buckets.swap(buckets);
+    }
+
+    size_t d_count;
+    //! a power of two number of buckets.
+    std::vector<Entry*> d_buckets;
+};
+
+//----------------------------------------------------------------------------//
+InternedString::InternedString(const String& str)
+{
+    Pool& pool = getPool();
+    const size_t h = hash(str);
+
+    d_entry = pool.find(str, h);
+    if (!d_entry)
+        d_entry = pool.add(str, h);
+
+    ++d_entry->d_refCount;
+}
+
+//----------------------------------------------------------------------------//
+InternedString::InternedString(Entry* entry) :
+    d_entry(entry)
+{
+    if (d_entry)
+        ++d_entry->d_refCount;
+}
+
+//----------------------------------------------------------------------------//
+InternedString InternedString::find(const StringView& str)
+{
+    return InternedString(getPool().find(str, hash(str)));
+}
+
+//----------------------------------------------------------------------------//
+size_t InternedString::hash(const StringView& str)
+{
+    // FNV-1a over the code points, so that views of the same code points in
+    // any encoding hash alike.
+    size_t h = 2166136261u;
+
+    for (StringView::size_type unit = 0; unit < str.getUnitCount();)
+    {
+        h ^= str.decode(unit);
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+//----------------------------------------------------------------------------//
+size_t InternedString::getPooledCount()
+{
+    return getPool().getCount();
+}
+
+//----------------------------------------------------------------------------//
+InternedString::Pool& InternedString::getPool()
+{
+    // created on first use, since InternedStrings may be constructed during
+    // static initialisation, and never destroyed, since they may also be
+    // destroyed during static destruction.
+    static Pool* const pool = new Pool;
+    return *pool;
+}
+
+//----------------------------------------------------------------------------//
+void InternedString::release(Entry* entry)
+{
+    getPool().remove(entry);
+}
+
+//----------------------------------------------------------------------------//
+const String& InternedString::getEmptyString()
+{
+    static const String* const empty = new String;
+    return *empty;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "CEGUIBase.h"
+#include "CEGUIString.h"
+#include "CEGUIStringView.h"
+
+namespace CEGUI
+{
+/*!
+\brief
+    Handle to a String held once in a process wide pool.
+
+    Constructing an InternedString looks the String up in the pool by its
+    hash, adding it if it is not there yet.  Copies of a handle share the
+    pooled String, which leaves the pool once no handle refers to it.
+
+    Handles compare equal, in constant time, when they refer to the same
+    pooled String, and carry the String's precomputed hash.  This makes them
+    cheap keys for the hashed lookups of InternedStringMap, which holds the
+    registries of window names, window types and property names; those are
+    looked up far more often than they change, and many windows repeat the
+    same names.
+
+    Registries are searched with find, which takes a StringView, so that
+    looking a name up neither allocates nor adds unknown names to the
+    pool.  Like the rest of CEGUI, the pool is not thread safe.
+*/
+class InternedString
+{
+public:
+    //! Construct a null handle, which refers to no String.
+    InternedString() : d_entry(0) {}
+
+    //! Construct a handle to \a str, adding it to the pool if needed.
+    explicit InternedString(const String& str);
+
+    InternedString(const InternedString& other) :
+        d_entry(other.d_entry)
+    {
+        if (d_entry)
+            ++d_entry->d_refCount;
+    }
+
+    ~InternedString()
+    {
+        if (d_entry && !--d_entry->d_refCount)
+            release(d_entry);
+    }
+
+    InternedString& operator=(const InternedString& other)
+    {
+        InternedString temp(other);
+        Entry* const entry = d_entry;
+        d_entry = temp.d_entry;
+        temp.d_entry = entry;
+        return *this;
+    }
+
+    /*!
+    \brief
+        Return a handle to \a str if it is in the pool, or a null handle if
+        it is not, without adding it.  A null handle matches no registry key.
+    */
+    static InternedString find(const StringView& str);
+
+    //! Return whether this is a null handle.
+    bool isNull() const
+        { return d_entry == 0; }
+
+    //! Return the String; the empty String for a null handle.
+    const String& str() const
+        { return d_entry ? d_entry->d_string : getEmptyString(); }
+
+    operator const String&() const
+        { return str(); }
+
+    //! Return the hash of the String, as computed by hash.
+    size_t getHash() const
+        { return d_entry ? d_entry->d_hash : 0; }
+
+    bool operator==(const InternedString& other) const
+        { return d_entry == other.d_entry; }
+
+    bool operator!=(const InternedString& other) const
+        { return d_entry != other.d_entry; }
+
+    //! Return the hash of the code points of \a str used by the pool.
+    static size_t hash(const StringView& str);
+
+    //! Return the number of distinct Strings in the pool.
+    static size_t getPooledCount();
+
+private:
+    //! A pooled String.
+    struct Entry
+    {
+        String d_string;
+        size_t d_hash;
+        //! number of handles referring to the entry.
+        uint d_refCount;
+        //! next entry in the same hash bucket.
+        Entry* d_next;
+    };
+
+    //! The pool, defined in CEGUIInternedString.cpp.
+    class Pool;
+
+    //! construct a handle to \a entry, which may be 0.
+    explicit InternedString(Entry* entry);
+
+    static Pool& getPool();
+    //! remove \a entry, which is no longer referred to, from the pool.
+    static void release(Entry* entry);
+    static const String& getEmptyString();
+
+    Entry* d_entry;
+};
+
+}
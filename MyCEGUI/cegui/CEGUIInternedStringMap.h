@@ -0,0 +1,185 @@
+#pragma once
+
+#include "CEGUIBase.h"
+#include "CEGUIInternedString.h"
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace CEGUI
+{
+/*!
+\brief
+    Map from InternedString keys to values, for the registries of window
+    names, window types and property names.
+
+    The entries are kept in a std::map ordered by name, in the order of
+    String::FastLessCompare, so iterating a registry visits the same
+    sequence no matter in which order the names were first interned.
+    Lookups do not search the map: an open addressing hash table over the
+    keys' precomputed hashes holds an iterator to each entry, and keys are
+    matched by comparing handles.
+
+    Only the members of std::map used by the registries, and by
+    ConstBaseIterator, are provided.
+*/
+template <typename T>
+class InternedStringMap
+{
+public:
+    //! orders handles by the name they refer to.
+    struct NameLess
+    {
+        bool operator()(const InternedString& a, const InternedString& b) const
+        {
+            return (a != b) && String::FastLessCompare()(a.str(), b.str());
+        }
+    };
+
+    typedef std::map<InternedString, T, NameLess> Map;
+    typedef typename Map::key_type key_type;
+    typedef typename Map::mapped_type mapped_type;
+    typedef typename Map::value_type value_type;
+    typedef typename Map::size_type size_type;
+    typedef typename Map::iterator iterator;
+    typedef typename Map::const_iterator const_iterator;
+
+    InternedStringMap() :
+        d_slots(s_minSlots, d_map.end())
+    {}
+
+    InternedStringMap(const InternedStringMap& other) :
+        d_map(other.d_map),
+        d_slots(other.d_slots.size(), d_map.end())
+    {
+        reindex();
+    }
+
+    InternedStringMap& operator=(const InternedStringMap& other)
+    {
+        if (this != &other)
+        {
+            d_map = other.d_map;
+            d_slots.assign(other.d_slots.size(), d_map.end());
+            reindex();
+        }
+
+        return *this;
+    }
+
+    iterator begin()
+        { return d_map.begin(); }
+
+    const_iterator begin() const
+        { return d_map.begin(); }
+
+    iterator end()
+        { return d_map.end(); }
+
+    const_iterator end() const
+        { return d_map.end(); }
+
+    bool empty() const
+        { return d_map.empty(); }
+
+    size_type size() const
+        { return d_map.size(); }
+
+    //! Return the entry for \a key, or end() if there is none.
+    iterator find(const InternedString& key)
+    {
+        if (key.isNull())
+            return d_map.end();
+
+        return d_slots[findSlot(key)];
+    }
+
+    //! Return the entry for \a key, or end() if there is none.
+    const_iterator find(const InternedString& key) const
+    {
+        if (key.isNull())
+            return d_map.end();
+
+        return d_slots[findSlot(key)];
+    }
+
+    //! Return the value for \a key, adding a default one if there is none.
+    T& operator[](const InternedString& key)
+    {
+        size_t slot = findSlot(key);
+
+        if (d_slots[slot] == d_map.end())
+        {
+            // keep the load factor at most one half.
+            if ((d_map.size() + 1) * 2 > d_slots.size())
+            {
+                d_slots.assign(d_slots.size() * 2, d_map.end());
+                reindex();
+                slot = findSlot(key);
+            }
+
+            d_slots[slot] = d_map.insert(value_type(key, T())).first;
+        }
+
+        return d_slots[slot]->second;
+    }
+
+    void erase(iterator pos)
+    {
+        const size_t mask = d_slots.size() - 1;
+        size_t hole = findSlot(pos->first);
+
+        // shift back the entries that probed past the removed one, so that
+        // every entry stays reachable from its home slot.
+        for (size_t i = (hole + 1) & mask; d_slots[i] != d_map.end();
+             i = (i + 1) & mask)
+        {
+            const size_t home = d_slots[i]->first.getHash() & mask;
+
+            if (((i - home) & mask) >= ((i - hole) & mask))
+            {
+                d_slots[hole] = d_slots[i];
+                hole = i;
+            }
+        }
+
+        d_slots[hole] = d_map.end();
+        d_map.erase(pos);
+    }
+
+    void clear()
+    {
+        d_map.clear();
+        d_slots.assign(s_minSlots, d_map.end());
+    }
+
+private:
+    //! number of slots of an empty map; a power of two.
+    static const size_t s_minSlots = 16;
+
+    //! return the slot holding \a key, or the empty slot where it belongs.
+    size_t findSlot(const InternedString& key) const
+    {
+        const size_t mask = d_slots.size() - 1;
+        size_t i = key.getHash() & mask;
+
+        while (d_slots[i] != d_map.end() && d_slots[i]->first != key)
+            i = (i + 1) & mask;
+
+        return i;
+    }
+
+    //! re-enter every entry of d_map into the cleared d_slots.
+    void reindex()
+    {
+        for (iterator e = d_map.begin(); e != d_map.end(); ++e)
+            d_slots[findSlot(e->first)] = e;
+    }
+
+    //! the entries, in name order.
+    Map d_map;
+    //! a power of two number of slots; unused ones hold d_map.end().
+    std::vector<iterator> d_slots;
+};
+
+}
@@ -2,6 +2,8 @@
 
 #include "CEGUISlotFunctorBase.h"
 
+#include <new>
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -23,6 +25,11 @@ public:
         return (d_object->*d_function)(args);
     }
 
+    virtual SlotFunctorBase* copyTo(void* buffer) const
+    {
+        return new (buffer) MemberFunctionSlot(*this);
+    }
+
 private:
     MemberFunctionType d_function;
     T* d_object;
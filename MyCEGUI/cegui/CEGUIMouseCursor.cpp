@@ -82,8 +82,10 @@ void MouseCursor::setImage(const Image* image)
     if (image == d_cursorImage)
         return;
 
+    invalidateDrawnArea();
 	d_cursorImage = image;
     d_cachedGeometryValid = false;
+    invalidateDrawnArea();
 
 	MouseCursorEventArgs args(this);
 	args.image = image;
@@ -120,10 +122,13 @@ void MouseCursor::draw(void) const
 *************************************************************************/
 void MouseCursor::setPosition(const Point& position)
 {
+    invalidateDrawnArea();
+
     d_position = position;
 	constrainPosition();
 
     d_geometry->setTranslation(Vector3(d_position.d_x, d_position.d_y, 0));
+    invalidateDrawnArea();
 }
 
 
@@ -132,11 +137,14 @@ void MouseCursor::setPosition(const Point& position)
 *************************************************************************/
 void MouseCursor::offsetPosition(const Point& offset)
 {
+    invalidateDrawnArea();
+
 	d_position.d_x += offset.d_x;
 	d_position.d_y += offset.d_y;
 	constrainPosition();
 
     d_geometry->setTranslation(Vector3(d_position.d_x, d_position.d_y, 0));
+    invalidateDrawnArea();
 }
 
 
@@ -254,8 +262,23 @@ void MouseCursor::notifyDisplaySizeChanged(const Size& new_size)
 //----------------------------------------------------------------------------//
 void MouseCursor::setExplicitRenderSize(const Size& size)
 {
+    invalidateDrawnArea();
     d_customSize = size;
     d_cachedGeometryValid = false;
+    invalidateDrawnArea();
+}
+
+//----------------------------------------------------------------------------//
+void MouseCursor::setVisible(bool visible)
+{
+    if (visible == d_visible)
+        return;
+
+    // invalidate while visible, so the area is redrawn either way.
+    if (visible)
+        d_visible = true;
+    invalidateDrawnArea();
+    d_visible = visible;
 }
 
 //----------------------------------------------------------------------------//
@@ -310,6 +333,26 @@ void MouseCursor::invalidate()
     d_cachedGeometryValid = false;
 }
 
+//----------------------------------------------------------------------------//
+void MouseCursor::invalidateDrawnArea() const
+{
+    if (!d_visible || !d_cursorImage)
+        return;
+
+    // the same area that cacheGeometry draws the image to.
+    Point pos(d_position + d_cursorImage->getOffsets());
+    Size sz(d_cursorImage->getSize());
+
+    if (d_customSize.d_width != 0.0f || d_customSize.d_height != 0.0f)
+    {
+        calculateCustomOffset();
+        pos += d_customOffset;
+        sz = d_customSize;
+    }
+
+    System::getSingleton().invalidateScreenArea(Rect(pos, sz));
+}
+
 //////////////////////////////////////////////////////////////////////////
 /*************************************************************************
 
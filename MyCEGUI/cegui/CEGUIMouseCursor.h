@@ -186,7 +186,7 @@ public:
 	\return
 		Nothing.
 	*/
-	void	hide(void)		{d_visible = false;}
+	void	hide(void)		{setVisible(false);}
 
 
 	/*!
@@ -196,7 +196,7 @@ public:
 	\return
 		Nothing.
 	*/
-	void	show(void)		{d_visible = true;}
+	void	show(void)		{setVisible(true);}
 
 
     /*!
@@ -209,7 +209,7 @@ public:
     \return
         Nothing.
     */
-    void    setVisible(bool visible)    {d_visible = visible;}
+    void    setVisible(bool visible);
 
 
 	/*!
@@ -351,6 +351,9 @@ private:
     //! calculate offset for custom image size so 'hot spot' is maintained.
     void calculateCustomOffset() const;
 
+    //! mark the area of the display covered by the cursor as needing redraw.
+    void invalidateDrawnArea() const;
+
 	/*************************************************************************
 		Implementation Data
 	*************************************************************************/
@@ -0,0 +1,169 @@
+#include "CEGUIPostedEventQueue.h"
+#include "CEGUIWindowManager.h"
+#include "CEGUIWindow.h"
+
+#if defined(__WIN32__) || defined(_WIN32)
+#   include <windows.h>
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+namespace
+{
+// atomically replace *dest by exchange if it equals comparand; returns the
+// previous value of *dest.  Acts as a full memory barrier.
+template<typename T>
+T* compareExchange(T* volatile* dest, T* exchange, T* comparand)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    return static_cast<T*>(InterlockedCompareExchangePointer(
+        reinterpret_cast<void* volatile*>(dest), exchange, comparand));
+#else
+    return __sync_val_compare_and_swap(dest, comparand, exchange);
+#endif
+}
+
+// return *src, reading it with acquire semantics.
+template<typename T>
+T* load(T* volatile* src)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    // volatile reads have acquire semantics with Visual C++.
+    return *src;
+#else
+    return __atomic_load_n(src, __ATOMIC_ACQUIRE);
+#endif
+}
+
+}
+
+//----------------------------------------------------------------------------//
+PostedEventQueue::PostedEventQueue() :
+    d_head(0),
+    d_dropped(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+PostedEventQueue::~PostedEventQueue()
+{
+    Node* node = takeAll();
+
+    while (node)
+    {
+        Node* const next = node->d_next;
+        delete node;
+        node = next;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void PostedEventQueue::post(const String& window_name,
+                            const String& event_name,
+                            const String& payload)
+{
+    Node* const node = new Node;
+    node->d_window = window_name;
+    node->d_eventName = event_name;
+    node->d_payload = payload;
+
+    push(node);
+}
+
+//----------------------------------------------------------------------------//
+uint PostedEventQueue::drain()
+{
+    // cheap test, so that an empty queue costs no atomic read-modify-write.
+    if (!load(&d_head))
+        return 0;
+
+    WindowManager& wmgr = WindowManager::getSingleton();
+    uint fired = 0;
+
+    Node* node = takeAll();
+
+    while (node)
+    {
+        if (Window* const wnd = wmgr.findWindow(node->d_window))
+        {
+            PostedEventArgs args(wnd, node->d_payload);
+
+            // names from other threads are not interned; one that never was
+            // has no subscribers.  Posted events are already deferred, so
+            // they bypass the EventQueue, which would fire them without
+            // their PostedEventArgs.
+            const EventID id(EventID::find(node->d_eventName));
+            if (id.isValid())
+                wnd->EventSet::fireEvent(id, args, Window::EventNamespace);
+
+            ++fired;
+        }
+        else
+            ++d_dropped;
+
+        Node* const next = node->d_next;
+        delete node;
+        node = next;
+    }
+
+    return fired;
+}
+
+//----------------------------------------------------------------------------//
+uint PostedEventQueue::getDroppedCount() const
+{
+    return d_dropped;
+}
+
+//----------------------------------------------------------------------------//
+void PostedEventQueue::push(Node* node)
+{
+    Node* head = load(&d_head);
+
+    for (;;)
+    {
+        node->d_next = head;
+
+        Node* const previous = compareExchange(&d_head, node, head);
+        if (previous == head)
+            return;
+
+        head = previous;
+    }
+}
+
+//----------------------------------------------------------------------------//
+PostedEventQueue::Node* PostedEventQueue::takeAll()
+{
+    // detach the list; only pushes race with this, so there is no ABA issue.
+    Node* head = load(&d_head);
+
+    for (;;)
+    {
+        Node* const previous = compareExchange(&d_head,
+                                               static_cast<Node*>(0), head);
+        if (previous == head)
+            break;
+
+        head = previous;
+    }
+
+    // the list is newest first; reverse it to deliver in posting order.
+    Node* ordered = 0;
+
+    while (head)
+    {
+        Node* const next = head->d_next;
+        head->d_next = ordered;
+        ordered = head;
+        head = next;
+    }
+
+    return ordered;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
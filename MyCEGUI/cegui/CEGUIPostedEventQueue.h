@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CEGUIBase.h"
+#include "CEGUIString.h"
+#include "CEGUIInputEvent.h"
+
+namespace CEGUI
+{
+/*!
+\brief
+    EventArgs for events posted via the PostedEventQueue.
+*/
+class PostedEventArgs : public WindowEventArgs
+{
+public:
+    PostedEventArgs(Window* wnd, const String& payload) :
+        WindowEventArgs(wnd),
+        d_payload(payload)
+    {}
+
+    //! the payload given when the event was posted.
+    String d_payload;
+};
+
+/*!
+\brief
+    Queue through which any thread may post events to windows, to be fired on
+    the GUI thread.
+
+    post may be called from any thread at any time and never blocks: posted
+    events are pushed onto a lock-free list with a single atomic
+    compare-and-swap.  The System drains the queue at the start of each
+    injectTimePulse, on the GUI thread, firing each event - in the order it was
+    posted - on the window of the given name with a PostedEventArgs holding
+    the payload.  Events for windows that no longer exist are dropped.
+
+    Nothing else in CEGUI is thread safe; in particular EventIDs must not be
+    created on other threads.  Event names are therefore posted as Strings,
+    and looked up - without being interned - when delivered; existing
+    EventIDs, such as the Window::Event* constants, convert to their name and
+    may be posted too.  Posted events are fired directly, even where the
+    EventQueue defers other firings of the same event, so that their
+    handlers always receive the PostedEventArgs.
+*/
+class PostedEventQueue
+{
+public:
+    //! Constructor.
+    PostedEventQueue();
+
+    //! Destructor.  Any events still queued are discarded.
+    ~PostedEventQueue();
+
+    /*!
+    \brief
+        Post the event \a event_name to the window named \a window_name.
+        May be called from any thread.
+    */
+    void post(const String& window_name, const String& event_name,
+              const String& payload = "");
+
+    /*!
+    \brief
+        Fire all events posted so far.  Must be called on the GUI thread.
+
+    \return
+        Number of events fired.
+    */
+    uint drain();
+
+    //! Return the number of events dropped since their window did not exist.
+    uint getDroppedCount() const;
+
+private:
+    struct Node
+    {
+        Node* d_next;
+        String d_window;
+        String d_eventName;
+        String d_payload;
+    };
+
+    //! push \a node onto d_head; lock-free.
+    void push(Node* node);
+    //! detach and return the whole list, oldest post first.
+    Node* takeAll();
+
+    // Copying would share the list.
+    PostedEventQueue(const PostedEventQueue&);
+    PostedEventQueue& operator=(const PostedEventQueue&);
+
+    //! most recently posted event; written by any thread.
+    Node* volatile d_head;
+    //! number of events dropped by drain.
+    uint d_dropped;
+};
+
+}
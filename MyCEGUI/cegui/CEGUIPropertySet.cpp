@@ -15,20 +15,20 @@ void PropertySet::addProperty(Property* property)
 		CEGUI_THROW(NullObjectException("The given Property object pointer is invalid."));
 	}
 
-	if (d_properties.find(property->getName()) != d_properties.end())
+	if (d_properties.find(InternedString::find(property->getName())) != d_properties.end())
 	{
 		CEGUI_THROW(AlreadyExistsException("A Property named '" + property->getName() + "' already exists in the PropertySet."));
 	}
 
-	d_properties[property->getName()] = property;
+	d_properties[InternedString(property->getName())] = property;
 }
 
 /*************************************************************************
 	Remove a property from the set
 *************************************************************************/
-void PropertySet::removeProperty(const String& name)
+void PropertySet::removeProperty(const StringView& name)
 {
-	PropertyRegistry::iterator pos = d_properties.find(name);
+	PropertyRegistry::iterator pos = d_properties.find(InternedString::find(name));
 
 	if (pos != d_properties.end())
 	{
@@ -47,21 +47,21 @@ void PropertySet::clearProperties(void)
 /*************************************************************************
 	Return true if a property with the given name is in the set
 *************************************************************************/
-bool PropertySet::isPropertyPresent(const String& name) const
+bool PropertySet::isPropertyPresent(const StringView& name) const
 {
-	return (d_properties.find(name) != d_properties.end());
+	return (d_properties.find(InternedString::find(name)) != d_properties.end());
 }
 
 /*************************************************************************
 	Return the help string for a property
 *************************************************************************/
-const String& PropertySet::getPropertyHelp(const String& name) const
+const String& PropertySet::getPropertyHelp(const StringView& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	PropertyRegistry::const_iterator pos = d_properties.find(InternedString::find(name));
 
 	if (pos == d_properties.end())
 	{
-		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
+		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name.str() + "' available in the set."));
 	}
 
 	return pos->second->getHelp();
@@ -70,13 +70,13 @@ const String& PropertySet::getPropertyHelp(const String& name) const
 /*************************************************************************
 	Return the current value of a property
 *************************************************************************/
-String PropertySet::getProperty(const String& name) const
+String PropertySet::getProperty(const StringView& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	PropertyRegistry::const_iterator pos = d_properties.find(InternedString::find(name));
 
 	if (pos == d_properties.end())
 	{
-		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
+		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name.str() + "' available in the set."));
 	}
 
 	//ǵǰָ
@@ -86,13 +86,13 @@ String PropertySet::getProperty(const String& name) const
 /*************************************************************************
 	Set the current value of a property
 *************************************************************************/
-void PropertySet::setProperty(const String& name,const String& value)
+void PropertySet::setProperty(const StringView& name,const String& value)
 {
-	PropertyRegistry::iterator pos = d_properties.find(name);
+	PropertyRegistry::iterator pos = d_properties.find(InternedString::find(name));
 
 	if (pos == d_properties.end())
 	{
-		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
+		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name.str() + "' available in the set."));
 	}
 	//ǵǰָ
 	pos->second->set(this, value);
@@ -112,13 +112,13 @@ PropertySet::Iterator PropertySet::getIterator(void) const
 /*************************************************************************
 	Returns whether a Property is at it's default value.
 *************************************************************************/
-bool PropertySet::isPropertyDefault(const String& name) const
+bool PropertySet::isPropertyDefault(const StringView& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	PropertyRegistry::const_iterator pos = d_properties.find(InternedString::find(name));
 
 	if (pos == d_properties.end())
 	{
-		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
+		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name.str() + "' available in the set."));
 	}
 
 	return pos->second->isDefault(this);
@@ -128,13 +128,13 @@ bool PropertySet::isPropertyDefault(const String& name) const
 /*************************************************************************
 	Returns the default value of a Property as a String.	
 *************************************************************************/
-String PropertySet::getPropertyDefault(const String& name) const
+String PropertySet::getPropertyDefault(const StringView& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	PropertyRegistry::const_iterator pos = d_properties.find(InternedString::find(name));
 
 	if (pos == d_properties.end())
 	{
-		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
+		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name.str() + "' available in the set."));
 	}
 
 	return pos->second->getDefault(this);
@@ -2,6 +2,8 @@
 
 #include "CEGUIBase.h"
 #include "CEGUIString.h"
+#include "CEGUIInternedStringMap.h"
+#include "CEGUIStringView.h"
 #include "CEGUIIteratorBase.h"
 #include "CEGUIProperty.h"
 #include <map>
@@ -19,21 +21,21 @@ public:
 	//exception NullObjectException		Thrown if \a property is NULL.
 	//exception AlreadyExistsException	Thrown if a Property with the same name as \a property already exists in the PropertySet
 	void	addProperty(Property* property);
-	void	removeProperty(const String& name);
+	void	removeProperty(const StringView& name);
 	void	clearProperties(void);
-	bool	isPropertyPresent(const String& name) const;
+	bool	isPropertyPresent(const StringView& name) const;
 	//exception UnknownObjectException	Thrown if no Property named \a name is in the PropertySet.
-	const String&	getPropertyHelp(const String& name) const;
+	const String&	getPropertyHelp(const StringView& name) const;
 	//exception UnknownObjectException	Thrown if no Property named \a name is in the PropertySet.
-	String	getProperty(const String& name) const;
+	String	getProperty(const StringView& name) const;
 	//exception UnknownObjectException	Thrown if no Property named \a name is in the PropertySet.
 	//exception InvalidRequestException	Thrown when the Property was unable to interpret the content of \a value.
-	void	setProperty(const String& name, const String& value);
-	bool	isPropertyDefault(const String& name) const;
-	String	getPropertyDefault(const String& name) const;
+	void	setProperty(const StringView& name, const String& value);
+	bool	isPropertyDefault(const StringView& name) const;
+	String	getPropertyDefault(const StringView& name) const;
 
 private:
-	typedef std::map<String, Property*, String::FastLessCompare>	PropertyRegistry;
+	typedef InternedStringMap<Property*>	PropertyRegistry;
 	PropertyRegistry	d_properties;
 
 
@@ -4,48 +4,56 @@ namespace CEGUI
 {
 
 //üķװ
+/*!
+\brief
+    Intrusive reference counted handle.
+
+    The count is kept in the object itself, so taking a reference never
+    allocates: T must have an unsigned int member d_refCount, initially 0,
+    accessible to RefCounted.  The object is deleted when the last handle
+    referring to it goes away.
+*/
 template<typename T>
 class RefCounted
 {
 public:
     RefCounted() :
-        d_object(0),
-        d_count(0)
+        d_object(0)
     {
     }
 
     RefCounted(T* ob) :
-        d_object(ob),
-        d_count((ob != 0) ? new unsigned int(1) : 0)
+        d_object(ob)
     {
+        if (d_object)
+            addRef();
     }
 
     RefCounted(const RefCounted<T>& other) :
-        d_object(other.d_object),
-        d_count(other.d_count)
+        d_object(other.d_object)
     {
-        if (d_count)
+        if (d_object)
             addRef();
     }
 
     ~RefCounted()
     {
         if (d_object)
-            release();
+            release(d_object);
     }
 
     RefCounted<T>& operator=(const RefCounted<T>& other)
     {
         if (*this != other)       //жǷ
         {
-            if (d_object)         //ͷǰĶ
-                release();
+            T* const previous = d_object;
 
             d_object = other.d_object;
-            d_count = d_object ? other.d_count : 0;
-
-            if (d_count)
+            if (d_object)
                 addRef();
+
+            if (previous)         //ͷǰĶ
+                release(previous);
         }
         return *this;
     }
@@ -94,21 +102,16 @@ public:
 private:
     void addRef()
     {
-        ++*d_count;
+        ++d_object->d_refCount;
     }
-    void release()
+
+    static void release(T* ob)
     {
-        if (!--*d_count)
-        {
-            delete d_object;
-            delete d_count;
-            d_object = 0;
-            d_count = 0;
-        }
+        if (!--ob->d_refCount)
+            delete ob;
     }
 
     T* d_object;            //! pointer to the object.
-    unsigned int* d_count;  //! pointer to the shared counter object.
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,326 @@
+#include "CEGUIRenderProfiler.h"
+#include "CEGUIWindow.h"
+#include "CEGUIExceptions.h"
+#include "CEGUIClock.h"
+
+#include <fstream>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// write \a str to \a out as a JSON string literal.
+static void writeJSONString(std::ostream& out, const char* str)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    out << '"';
+    for (const unsigned char* c = reinterpret_cast<const unsigned char*>(str);
+         *c; ++c)
+    {
+        switch (*c)
+        {
+        case '"':  out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\r': out << "\\r"; break;
+        case '\t': out << "\\t"; break;
+        default:
+            if (*c < 0x20)
+                out << "\\u00" << hex[*c >> 4] << hex[*c & 0xF];
+            else
+                out << *c;
+        }
+    }
+    out << '"';
+}
+
+//----------------------------------------------------------------------------//
+RenderProfiler::RenderProfiler() :
+    d_enabled(false),
+    d_inFrame(false),
+    d_frameNumber(0),
+    d_frameStart(0),
+    d_lastFrameTime(0),
+    d_traceCapacity(1024 * 1024)
+{
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::setEnabled(bool setting)
+{
+    if (setting == d_enabled)
+        return;
+
+    d_enabled = setting;
+
+    if (d_enabled)
+        d_frameNumber = 0;
+
+    d_currentFrame.clear();
+    d_frameIndex.clear();
+    d_bufferOwners.clear();
+    d_inFrame = false;
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::setTraceCapacity(size_t capacity)
+{
+    d_traceCapacity = capacity;
+
+    if (d_trace.size() > capacity)
+        d_trace.resize(capacity);
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::clearTrace()
+{
+    d_trace.clear();
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::writeChromeTrace(const String& filename) const
+{
+    std::ofstream out(filename.c_str(),
+                      std::ios_base::out | std::ios_base::trunc);
+
+    if (!out)
+        CEGUI_THROW(FileIOException("RenderProfiler::writeChromeTrace - "
+            "Failed to open file '" + filename + "' for writing."));
+
+    out.setf(std::ios_base::fixed, std::ios_base::floatfield);
+    out.precision(3);
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    for (size_t i = 0; i < d_trace.size(); ++i)
+    {
+        const TraceEvent& ev = d_trace[i];
+
+        out << (i ? ",\n" : "\n") << "{\"name\":";
+        if (ev.d_scope == S_Frame)
+            out << "\"Frame " << ev.d_value << '"';
+        else
+            writeJSONString(out, ev.d_window.c_str());
+
+        out << ",\"cat\":\"" << getScopeName(ev.d_scope) << '"'
+            << ",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+            << ",\"ts\":" << ev.d_start
+            << ",\"dur\":" << ev.d_duration;
+
+        if (ev.d_scope == S_Populate)
+            out << ",\"args\":{\"vertices\":" << ev.d_value
+                << ",\"reason\":\"" << getRedrawReasonName(ev.d_reason)
+                << "\"}";
+
+        out << '}';
+    }
+
+    out << "\n]}\n";
+
+    if (!out)
+        CEGUI_THROW(FileIOException("RenderProfiler::writeChromeTrace - "
+            "Failed to write file '" + filename + "'."));
+}
+
+//----------------------------------------------------------------------------//
+const RenderProfiler::WindowTiming* RenderProfiler::getWindowTiming(
+                                                const String& name) const
+{
+    for (size_t i = 0; i < d_lastFrame.size(); ++i)
+        if (d_lastFrame[i].d_name == name)
+            return &d_lastFrame[i];
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------//
+const char* RenderProfiler::getRedrawReasonName(RedrawReason reason)
+{
+    static const char* const names[RR_Count] =
+    {
+        "none", "initial", "invalidated", "parent invalidated"
+    };
+
+    return (reason < RR_Count) ? names[reason] : "unknown";
+}
+
+//----------------------------------------------------------------------------//
+const char* RenderProfiler::getScopeName(Scope scope)
+{
+    static const char* const names[S_Count] =
+    {
+        "render", "bufferGeometry", "populate", "draw", "frame"
+    };
+
+    return (scope < S_Count) ? names[scope] : "unknown";
+}
+
+//----------------------------------------------------------------------------//
+double RenderProfiler::getTimestamp()
+{
+    return static_cast<double>(Clock::getTime()) * 1e-3;
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::beginFrame()
+{
+    if (!d_enabled)
+        return;
+
+    d_currentFrame.clear();
+    d_frameIndex.clear();
+    d_inFrame = true;
+    d_frameStart = getTimestamp();
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::endFrame()
+{
+    if (!d_enabled || !d_inFrame)
+        return;
+
+    d_lastFrameTime = getTimestamp() - d_frameStart;
+    addTraceEvent(S_Frame, String(), d_frameStart, d_lastFrameTime,
+                  d_frameNumber);
+
+    // swap, so the storage of both lists is reused by later frames.
+    d_lastFrame.swap(d_currentFrame);
+    d_currentFrame.clear();
+    d_frameIndex.clear();
+
+    d_inFrame = false;
+    ++d_frameNumber;
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::recordScope(Scope scope, const Window& window,
+                                 double start)
+{
+    if (!d_inFrame)
+        return;
+
+    const double duration = getTimestamp() - start;
+    WindowTiming& timing = getFrameTiming(window);
+
+    switch (scope)
+    {
+    case S_Render:
+        timing.d_renderTime += duration;
+        break;
+
+    case S_BufferGeometry:
+        timing.d_bufferTime += duration;
+        break;
+
+    case S_Populate:
+        timing.d_populateTime += duration;
+        break;
+
+    case S_Draw:
+        timing.d_drawTime += duration;
+        break;
+
+    default:
+        break;
+    }
+
+    if (scope == S_Populate)
+        addTraceEvent(scope, timing.d_name, start, duration,
+                      timing.d_vertexCount, timing.d_reason);
+    else
+        addTraceEvent(scope, timing.d_name, start, duration);
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::recordGeometry(const Window& window, uint vertex_count,
+                                    RedrawReason reason)
+{
+    if (!d_inFrame)
+        return;
+
+    WindowTiming& timing = getFrameTiming(window);
+    timing.d_vertexCount = vertex_count;
+    timing.d_reason = reason;
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::setBufferOwner(const GeometryBuffer& buffer,
+                                    const Window& window)
+{
+    d_bufferOwners[&buffer] = &window;
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::removeBufferOwner(const GeometryBuffer& buffer)
+{
+    d_bufferOwners.erase(&buffer);
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::recordDraw(const GeometryBuffer& buffer, double start,
+                                float share)
+{
+    if (!d_inFrame)
+        return;
+
+    // buffers that do not belong to a window, such as those of
+    // RenderingWindows, are not attributed to anything.
+    std::map<const GeometryBuffer*, const Window*>::const_iterator i =
+        d_bufferOwners.find(&buffer);
+
+    if (i == d_bufferOwners.end())
+        return;
+
+    const double duration = (getTimestamp() - start) * share;
+    WindowTiming& timing = getFrameTiming(*i->second);
+    timing.d_drawTime += duration;
+
+    addTraceEvent(S_Draw, timing.d_name, start, duration);
+}
+
+//----------------------------------------------------------------------------//
+RenderProfiler::WindowTiming& RenderProfiler::getFrameTiming(
+                                                    const Window& window)
+{
+    std::map<const Window*, size_t>::iterator i = d_frameIndex.find(&window);
+
+    if (i != d_frameIndex.end())
+        return d_currentFrame[i->second];
+
+    d_frameIndex[&window] = d_currentFrame.size();
+
+    WindowTiming timing;
+    timing.d_name = window.getName();
+    timing.d_renderTime = 0;
+    timing.d_bufferTime = 0;
+    timing.d_populateTime = 0;
+    timing.d_drawTime = 0;
+    timing.d_vertexCount = 0;
+    timing.d_reason = RR_None;
+    d_currentFrame.push_back(timing);
+
+    return d_currentFrame.back();
+}
+
+//----------------------------------------------------------------------------//
+void RenderProfiler::addTraceEvent(Scope scope, const String& window,
+                                   double start, double duration, uint value,
+                                   RedrawReason reason)
+{
+    if (d_trace.size() >= d_traceCapacity)
+        return;
+
+    TraceEvent ev;
+    ev.d_scope = scope;
+    ev.d_window = window;
+    ev.d_start = start;
+    ev.d_duration = duration;
+    ev.d_value = value;
+    ev.d_reason = reason;
+    d_trace.push_back(ev);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
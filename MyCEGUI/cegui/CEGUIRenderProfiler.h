@@ -0,0 +1,239 @@
+#pragma once
+
+#include "CEGUIBase.h"
+#include "CEGUIString.h"
+
+#include <map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Opt-in instrumentation of the work done to render each frame.
+
+    While enabled, the profiler records how long each window spends in
+    Window::render, Window::bufferGeometry, the WindowRenderer::render or
+    populateGeometryBuffer call that builds its geometry and the
+    GeometryBuffer::draw calls for that geometry, together with the number of
+    vertices produced and the reason the geometry had to be rebuilt.
+
+    The per-window results of the most recent frame are available via
+    getWindowTimings.  All timed scopes are also kept as a trace, which can be
+    written to a file in the Chrome trace event format with writeChromeTrace
+    and then loaded into chrome://tracing or a compatible viewer.
+
+    The System owns the profiler, see System::getRenderProfiler.  When the
+    profiler is disabled, the instrumented functions only test isEnabled.
+*/
+class RenderProfiler
+{
+public:
+    //! Reasons for a window's geometry to be rebuilt.
+    enum RedrawReason
+    {
+        //! geometry was not rebuilt; the cached geometry was queued again.
+        RR_None,
+        //! the window has not been drawn before.
+        RR_Initial,
+        //! the window itself was invalidated.
+        RR_Invalidated,
+        //! an ancestor window was invalidated along with its children.
+        RR_ParentInvalidated,
+        //! number of reasons, not a valid reason.
+        RR_Count
+    };
+
+    //! The instrumented parts of the rendering process.
+    enum Scope
+    {
+        //! Window::render, including the windows drawn within it.
+        S_Render,
+        //! Window::bufferGeometry.
+        S_BufferGeometry,
+        //! WindowRenderer::render or Window::populateGeometryBuffer.
+        S_Populate,
+        //! GeometryBuffer::draw for the window's geometry.
+        S_Draw,
+        //! the whole of System::renderGUI.
+        S_Frame,
+        //! number of scopes, not a valid scope.
+        S_Count
+    };
+
+    //! Per-window results for one frame.  All times are in microseconds.
+    struct WindowTiming
+    {
+        //! name of the window.
+        String d_name;
+        //! time spent in Window::render, including descendant windows.
+        double d_renderTime;
+        //! time spent in Window::bufferGeometry.
+        double d_bufferTime;
+        //! time spent building the geometry.
+        double d_populateTime;
+        //! time spent drawing the window's geometry buffer.
+        double d_drawTime;
+        //! number of vertices in the geometry buffer after it was built.
+        uint d_vertexCount;
+        //! reason the geometry was rebuilt, or RR_None if it was not.
+        RedrawReason d_reason;
+    };
+
+    //! One timed scope as kept for the trace.
+    struct TraceEvent
+    {
+        Scope d_scope;
+        //! name of the window the scope relates to; empty for S_Frame.
+        String d_window;
+        //! start time in microseconds.
+        double d_start;
+        //! duration in microseconds.
+        double d_duration;
+        //! vertex count for S_Populate scopes, frame number for S_Frame.
+        uint d_value;
+        //! reason the geometry was rebuilt, for S_Populate scopes.
+        RedrawReason d_reason;
+    };
+
+    typedef std::vector<WindowTiming> WindowTimingList;
+    typedef std::vector<TraceEvent> TraceEventList;
+
+    //! Constructor.  The profiler is initially disabled.
+    RenderProfiler();
+
+    //! Enable or disable profiling.  Disabling keeps the recorded trace.
+    void setEnabled(bool setting);
+
+    //! Return whether profiling is enabled.
+    bool isEnabled() const {return d_enabled;}
+
+    /*!
+    \brief
+        Set the maximum number of trace events kept.  Once the trace holds
+        this many events, further events are dropped until clearTrace is
+        called; the per-frame window timings are still recorded.
+    */
+    void setTraceCapacity(size_t capacity);
+
+    //! Return the maximum number of trace events kept.
+    size_t getTraceCapacity() const {return d_traceCapacity;}
+
+    //! Return the trace events recorded so far.
+    const TraceEventList& getTraceEvents() const {return d_trace;}
+
+    //! Discard all trace events recorded so far.
+    void clearTrace();
+
+    /*!
+    \brief
+        Write the trace events recorded so far to \a filename using the JSON
+        based Chrome trace event format.
+
+    \exception FileIOException
+        thrown if the file could not be written.
+    */
+    void writeChromeTrace(const String& filename) const;
+
+    //! Return the per-window results for the most recent frame.
+    const WindowTimingList& getWindowTimings() const {return d_lastFrame;}
+
+    /*!
+    \brief
+        Return the results for the window named \a name in the most recent
+        frame, or 0 if that window was not rendered in that frame.
+    */
+    const WindowTiming* getWindowTiming(const String& name) const;
+
+    //! Return the duration of the most recent frame in microseconds.
+    double getFrameTime() const {return d_lastFrameTime;}
+
+    //! Return the number of frames recorded since profiling was enabled.
+    uint getFrameNumber() const {return d_frameNumber;}
+
+    //! Return the name of \a reason, as used in the trace.
+    static const char* getRedrawReasonName(RedrawReason reason);
+
+    //! Return the name of \a scope, as used in the trace.
+    static const char* getScopeName(Scope scope);
+
+    /*!
+    \brief
+        Return a timestamp in microseconds from the monotonic Clock, with an
+        arbitrary origin.
+    */
+    static double getTimestamp();
+
+    // functions called by the instrumented code.
+
+    //! called by System::renderGUI before anything is drawn.
+    void beginFrame();
+
+    //! called by System::renderGUI once everything is drawn.
+    void endFrame();
+
+    //! record that \a window spent from \a start until now in \a scope.
+    void recordScope(Scope scope, const Window& window, double start);
+
+    //! record that the geometry of \a window was rebuilt.
+    void recordGeometry(const Window& window, uint vertex_count,
+                        RedrawReason reason);
+
+    /*!
+    \brief
+        note that \a buffer holds the geometry of \a window.  Windows call
+        this as they render while profiling is enabled; the owners are
+        forgotten whenever profiling is enabled or disabled.
+    */
+    void setBufferOwner(const GeometryBuffer& buffer, const Window& window);
+
+    //! forget \a buffer; called, while profiling is enabled, when it is
+    //! about to be destroyed.
+    void removeBufferOwner(const GeometryBuffer& buffer);
+
+    /*!
+    \brief
+        record that \a buffer was drawn from \a start until now.  Where
+        buffers were merged, \a share is the part of the time attributed to
+        this buffer.
+    */
+    void recordDraw(const GeometryBuffer& buffer, double start,
+                    float share = 1.0f);
+
+private:
+    //! return the WindowTiming for \a window in the frame being recorded.
+    WindowTiming& getFrameTiming(const Window& window);
+
+    //! add an event to the trace, if there is space for it.
+    void addTraceEvent(Scope scope, const String& window, double start,
+                       double duration, uint value = 0,
+                       RedrawReason reason = RR_None);
+
+    bool d_enabled;
+    //! true between beginFrame and endFrame.
+    bool d_inFrame;
+    uint d_frameNumber;
+    double d_frameStart;
+    double d_lastFrameTime;
+    size_t d_traceCapacity;
+    TraceEventList d_trace;
+    //! results for the frame being recorded.
+    WindowTimingList d_currentFrame;
+    //! results for the most recent complete frame.
+    WindowTimingList d_lastFrame;
+    //! index of each window's results in d_currentFrame.
+    std::map<const Window*, size_t> d_frameIndex;
+    //! windows whose geometry is held in each buffer.
+    std::map<const GeometryBuffer*, const Window*> d_bufferOwners;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
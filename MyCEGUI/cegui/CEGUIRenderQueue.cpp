@@ -0,0 +1,190 @@
+#include "CEGUIRenderQueue.h"
+#include "CEGUIGeometryBuffer.h"
+#include "CEGUIRenderer.h"
+#include "CEGUIRenderProfiler.h"
+#include "CEGUISystem.h"
+
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+bool RenderQueue::s_mergingEnabled = true;
+uint RenderQueue::s_frameBuffersQueued = 0;
+uint RenderQueue::s_frameBuffersMerged = 0;
+
+//----------------------------------------------------------------------------//
+RenderQueue::RenderQueue() :
+    d_mergeBuffer(0),
+    d_mergeBufferOwner(0),
+    d_lastDrawCalls(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+RenderQueue::RenderQueue(const RenderQueue& other) :
+    d_buffers(other.d_buffers),
+    d_mergeBuffer(0),
+    d_mergeBufferOwner(0),
+    d_lastDrawCalls(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+RenderQueue::~RenderQueue()
+{
+    destroyMergeBuffer();
+}
+
+//----------------------------------------------------------------------------//
+RenderQueue& RenderQueue::operator=(const RenderQueue& other)
+{
+    d_buffers = other.d_buffers;
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::draw() const
+{
+    d_lastDrawCalls = 0;
+    s_frameBuffersQueued += d_buffers.size();
+
+    RenderProfiler& profiler = System::getSingleton().getRenderProfiler();
+
+    const size_t count = d_buffers.size();
+    size_t i = 0;
+    while (i < count)
+    {
+        // find the run of buffers that can be drawn together with this one.
+        size_t end = i + 1;
+        if (s_mergingEnabled)
+        {
+            while (end < count &&
+                   d_buffers[end - 1]->isMergeableWith(*d_buffers[end]))
+                ++end;
+        }
+
+        const double start =
+            profiler.isEnabled() ? RenderProfiler::getTimestamp() : 0;
+
+        if (end - i > 1)
+            drawMerged(&d_buffers[i], static_cast<uint>(end - i));
+        else
+            d_buffers[i]->draw();
+
+        // the time for a merged draw is shared evenly between its buffers.
+        if (profiler.isEnabled())
+            for (size_t j = i; j < end; ++j)
+                profiler.recordDraw(*d_buffers[j], start,
+                                    1.0f / static_cast<float>(end - i));
+
+        ++d_lastDrawCalls;
+        i = end;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::drawMerged(const GeometryBuffer* const* first,
+                             uint count) const
+{
+    Renderer* const renderer = System::getSingleton().getRenderer();
+
+    // the scratch buffer belongs to the renderer that created it.
+    if (d_mergeBuffer && d_mergeBufferOwner != renderer)
+        const_cast<RenderQueue*>(this)->destroyMergeBuffer();
+
+    if (!d_mergeBuffer)
+    {
+        d_mergeBuffer = &renderer->createGeometryBuffer();
+        d_mergeBufferOwner = renderer;
+    }
+
+    // reset keeps the buffer's storage, so after the first few frames
+    // building the merged geometry does not allocate.
+    d_mergeBuffer->reset();
+    for (uint i = 0; i < count; ++i)
+        d_mergeBuffer->appendMergedGeometry(*first[i]);
+
+    d_mergeBuffer->draw();
+
+    s_frameBuffersMerged += count;
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::destroyMergeBuffer()
+{
+    if (d_mergeBuffer)
+        d_mergeBufferOwner->destroyGeometryBuffer(*d_mergeBuffer);
+
+    d_mergeBuffer = 0;
+    d_mergeBufferOwner = 0;
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::addGeometryBuffer(const GeometryBuffer& buffer)
+{
+    d_buffers.push_back(&buffer);
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::removeGeometryBuffer(const GeometryBuffer& buffer)
+{
+    BufferList::iterator i = std::find(d_buffers.begin(), d_buffers.end(),
+                                       &buffer);
+    if (i != d_buffers.end())
+        d_buffers.erase(i);
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::reset()
+{
+    d_buffers.clear();
+}
+
+//----------------------------------------------------------------------------//
+uint RenderQueue::getGeometryBufferCount() const
+{
+    return d_buffers.size();
+}
+
+//----------------------------------------------------------------------------//
+uint RenderQueue::getLastDrawCallCount() const
+{
+    return d_lastDrawCalls;
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::setBatchMergingEnabled(bool setting)
+{
+    s_mergingEnabled = setting;
+}
+
+//----------------------------------------------------------------------------//
+bool RenderQueue::isBatchMergingEnabled()
+{
+    return s_mergingEnabled;
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::resetFrameCounters()
+{
+    s_frameBuffersQueued = 0;
+    s_frameBuffersMerged = 0;
+}
+
+//----------------------------------------------------------------------------//
+uint RenderQueue::getFrameBuffersQueued()
+{
+    return s_frameBuffersQueued;
+}
+
+//----------------------------------------------------------------------------//
+uint RenderQueue::getFrameBuffersMerged()
+{
+    return s_frameBuffersMerged;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "CEGUIBase.h"
+
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Class that represents a queue of GeometryBuffer objects to be rendered.
+
+    When batch merging is enabled, runs of consecutive buffers that report
+    themselves as compatible via GeometryBuffer::isMergeableWith - such as the
+    buffers of neighbouring windows that share an imageset - are combined into
+    a single scratch GeometryBuffer, with each source buffer's translation and
+    clipping applied on the CPU, and drawn with one call instead of one call
+    per buffer.
+
+\note
+    The GeometryBuffers added to a RenderQueue are not owned by it; it is the
+    responsibility of the caller to remove them from any RenderQueue before
+    destroying them.
+*/
+class RenderQueue
+{
+public:
+    //! Constructor.
+    RenderQueue();
+    //! Copy constructor.  The scratch merge buffer is not shared.
+    RenderQueue(const RenderQueue& other);
+    //! Destructor.
+    ~RenderQueue();
+    //! Assignment.  The scratch merge buffer is not shared.
+    RenderQueue& operator=(const RenderQueue& other);
+
+    //! draw the geometry buffers in the queue.
+    void draw() const;
+
+    /*!
+    \brief
+        Add a GeometryBuffer to the RenderQueue.  Ownership of the
+        GeometryBuffer does not pass to the RenderQueue.
+
+    \param buffer
+        GeometryBuffer that is to be added to the RenderQueue for later
+        rendering.
+    */
+    void addGeometryBuffer(const GeometryBuffer& buffer);
+
+    /*!
+    \brief
+        Remove a GeometryBuffer previously queued for rendering.  If the
+        GeometryBuffer is not present in the queue, nothing happens.
+
+    \param buffer
+        GeometryBuffer to be removed from the render queue.
+    */
+    void removeGeometryBuffer(const GeometryBuffer& buffer);
+
+    //! Reset the queue, by removing all queued geometry buffers.
+    void reset();
+
+    //! Return the number of geometry buffers in the queue.
+    uint getGeometryBufferCount() const;
+
+    //! Return the number of draw calls made by the last call to draw.
+    uint getLastDrawCallCount() const;
+
+    //! Enable or disable merging of compatible geometry buffers.
+    static void setBatchMergingEnabled(bool setting);
+
+    //! Return whether compatible geometry buffers are merged when drawn.
+    static bool isBatchMergingEnabled();
+
+    //! Reset the per-frame counters returned by the getFrame* functions.
+    static void resetFrameCounters();
+
+    /*!
+    \brief
+        Return the number of geometry buffers that all RenderQueues have been
+        asked to draw since resetFrameCounters was last called.
+    */
+    static uint getFrameBuffersQueued();
+
+    /*!
+    \brief
+        Return how many of the buffers returned by getFrameBuffersQueued were
+        drawn as part of a merged buffer rather than individually.
+    */
+    static uint getFrameBuffersMerged();
+
+private:
+    //! draw the run of \a count mergeable buffers starting at \a first.
+    void drawMerged(const GeometryBuffer* const* first, uint count) const;
+    //! release the scratch merge buffer, if one was created.
+    void destroyMergeBuffer();
+
+    //! type to use for the list of queued geometry buffers.
+    typedef std::vector<const GeometryBuffer*> BufferList;
+    //! list of geometry buffers that comprise the queue.
+    BufferList d_buffers;
+    //! scratch buffer that merged runs are built in, created on first use.
+    mutable GeometryBuffer* d_mergeBuffer;
+    //! Renderer that created d_mergeBuffer.
+    mutable Renderer* d_mergeBufferOwner;
+    //! number of draw calls made by the last call to draw.
+    mutable uint d_lastDrawCalls;
+
+    //! whether compatible buffers are merged.
+    static bool s_mergingEnabled;
+    //! buffers drawn since the last resetFrameCounters.
+    static uint s_frameBuffersQueued;
+    //! buffers drawn as part of a merged run since the last resetFrameCounters.
+    static uint s_frameBuffersMerged;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
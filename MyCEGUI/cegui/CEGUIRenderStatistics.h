@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CEGUIBase.h"
+
+namespace CEGUI
+{
+/*!
+\brief
+    Counters describing the work submitted to a Renderer during one frame.
+
+    A frame is everything between Renderer::beginRendering and
+    Renderer::endRendering.  Renderers that support statistics reset their
+    counters in beginRendering; System::renderGUI takes a copy once the frame
+    has ended, which is then available via System::getFrameStatistics.
+*/
+struct RenderStatistics
+{
+    //! number of vertices added to geometry buffers.
+    uint d_verticesAppended;
+    //! number of GeometryBuffer::draw calls.
+    uint d_geometryBuffersDrawn;
+    //! number of texture batches drawn.
+    uint d_batchesDrawn;
+    //! number of vertices drawn.
+    uint d_verticesDrawn;
+    //! number of times the texture changed between consecutive batches.
+    uint d_textureSwitches;
+    //! number of times the clipping (scissor) region changed.
+    uint d_scissorChanges;
+    //! number of times a different RenderTarget was activated.
+    uint d_renderTargetSwitches;
+    //! number of geometry buffers drawn via RenderQueues.
+    uint d_geometryBuffersQueued;
+    //! number of those buffers that were merged with a neighbouring buffer.
+    uint d_geometryBuffersMerged;
+
+    RenderStatistics() { reset(); }
+
+    //! set all counters back to zero.
+    void reset()
+    {
+        d_verticesAppended = 0;
+        d_geometryBuffersDrawn = 0;
+        d_batchesDrawn = 0;
+        d_verticesDrawn = 0;
+        d_textureSwitches = 0;
+        d_scissorChanges = 0;
+        d_renderTargetSwitches = 0;
+        d_geometryBuffersQueued = 0;
+        d_geometryBuffersMerged = 0;
+    }
+
+    //! return the fraction, 0 to 1, of queued buffers that were merged.
+    float getMergeRatio() const
+    {
+        return d_geometryBuffersQueued ?
+            static_cast<float>(d_geometryBuffersMerged) /
+                d_geometryBuffersQueued :
+            0.0f;
+    }
+};
+
+}
@@ -261,6 +261,53 @@ public:
     */
     virtual const String& getIdentifierString() const = 0;
 
+    /*!
+    \brief
+        Return the statistics collected by the renderer for the frame currently
+        being rendered, or for the last frame once endRendering has been called.
+
+    \return
+        Pointer to a RenderStatistics object, or 0 if the renderer does not
+        collect statistics.  The default implementation returns 0.
+    */
+    virtual const RenderStatistics* getRenderStatistics() const { return 0; }
+
+    /*!
+    \brief
+        Restrict drawing to the default RenderingRoot during the next frame -
+        the next beginRendering / endRendering pair - to the given areas of
+        the display.  Everything outside of those areas must keep the content
+        it had at the end of the previous frame.
+
+    \param areas
+        Pointer to an array of non-overlapping Rect objects describing the
+        areas of the display to be redrawn.
+
+    \param area_count
+        Number of Rect objects in the array \a areas.
+
+    \return
+        - true if the restriction will be applied.
+        - false if the renderer can not keep display content between frames,
+          so the whole display must be drawn.  The default implementation
+          returns false.
+    */
+    virtual bool setRedrawRegion(const Rect* /*areas*/, uint /*area_count*/)
+    { return false; }
+
+    /*!
+    \brief
+        Return whether the renderer keeps the content of the display between
+        frames, so that setRedrawRegion would apply a restriction and a frame
+        in which nothing changed need not be drawn at all.
+
+    \return
+        - true if display content is kept between frames.
+        - false if the whole display must be drawn every frame.  The default
+          implementation returns false.
+    */
+    virtual bool supportsRedrawRegion() const { return false; }
+
     //! Destructor.
     virtual ~Renderer() {}
 };
@@ -8,9 +8,12 @@ namespace CEGUI
 {
 	// holds the default resource group ID for loading script files.
 	String ScriptModule::d_defaultResourceGroup;
+	// last token given out by any module; tokens start at 1.
+	uint ScriptModule::s_lastResolvedHandlerToken = 0;
 
 	ScriptModule::ScriptModule(void) :
-	d_identifierString("Unknown scripting module (vendor did not set the ID string!)")
+	d_identifierString("Unknown scripting module (vendor did not set the ID string!)"),
+	d_resolvedHandlerToken(++s_lastResolvedHandlerToken)
 	{}
 
 	const String& ScriptModule::getIdentifierString() const
@@ -24,6 +27,18 @@ namespace CEGUI
 
 		if (scriptModule)
 		{
+			// resolve on first use, and again once the module - or the
+			// scripts it has loaded - changed.  Tokens are unique to one
+			// module and set of resolved handlers.
+			if (scriptModule->getResolvedHandlerToken() != d_token)
+			{
+				d_token = scriptModule->getResolvedHandlerToken();
+				d_handle = scriptModule->resolveScriptedEventHandler(scriptFunctionName);
+			}
+
+			if (d_handle != ScriptModule::NoResolvedHandler)
+				return scriptModule->executeResolvedEventHandler(d_handle, e);
+
 			return scriptModule->executeScriptedEventHandler(scriptFunctionName, e);
 		}
 		else
@@ -169,6 +169,59 @@ public:
     */
     virtual Event::Connection	subscribeEvent(EventSet* target, const String& name, Event::Group group, const String& subscriber_name) = 0;
 
+    //! Handle returned by resolveScriptedEventHandler when not resolved.
+    static const int NoResolvedHandler = -1;
+
+    /*!
+    \brief
+        Resolve the scripted event handler \a handler_name, so that it can be
+        executed repeatedly via executeResolvedEventHandler without looking
+        its name up each time.  ScriptFunctor resolves its handler on first
+        use.
+
+        Resolved handlers must stay valid until the module calls
+        invalidateResolvedHandlers, which it must do whenever it runs script
+        code that may redefine functions, such as in executeScriptFile and
+        executeString.
+
+        The default implementation resolves nothing, so that ScriptFunctor
+        executes handlers by name via executeScriptedEventHandler.
+
+    \param handler_name
+        String object holding the name of the scripted handler function.
+
+    \return
+        A handle for executeResolvedEventHandler, or NoResolvedHandler if the
+        handler could not be resolved.
+    */
+    virtual int resolveScriptedEventHandler(const String& /*handler_name*/)
+        { return NoResolvedHandler; }
+
+    /*!
+    \brief
+        Execute the scripted event handler \a handle, as returned by
+        resolveScriptedEventHandler, as executeScriptedEventHandler does.
+
+    \return
+        - true if the event was handled.
+        - false if the event was not handled.
+    */
+    virtual bool executeResolvedEventHandler(int /*handle*/,
+                                             const EventArgs& /*e*/)
+        { return false; }
+
+    /*!
+    \brief
+        Return the token identifying the handles currently resolved by this
+        module.  Tokens are unique within the process - a module gets a new
+        one when constructed and on every invalidateResolvedHandlers - so a
+        handle is valid exactly as long as the token it was resolved under
+        is still current, even if another module later lives at the same
+        address.  0 is never a token.
+    */
+    uint getResolvedHandlerToken() const
+        { return d_resolvedHandlerToken; }
+
     /*!
     \brief
         Sets the default resource group to be used when loading script files.
@@ -193,8 +246,20 @@ public:
         { return d_defaultResourceGroup; }
 
 protected:
+    /*!
+    \brief
+        Invalidate all handles returned by resolveScriptedEventHandler, so
+        that handlers are resolved again on their next use.
+    */
+    void invalidateResolvedHandlers()
+        { d_resolvedHandlerToken = ++s_lastResolvedHandlerToken; }
+
     //! String that holds some id information about the module.
     String d_identifierString;
+    //! current token for the resolved handles, see getResolvedHandlerToken.
+    uint d_resolvedHandlerToken;
+    //! last token given to any module.
+    static uint s_lastResolvedHandlerToken;
     //! holds the default resource group ID for loading script files.
     static String d_defaultResourceGroup;
 };
@@ -203,12 +268,25 @@ protected:
 /*!
 \brief
 	Functor class used for binding named script functions to events
+
+	The function is resolved via ScriptModule::resolveScriptedEventHandler on
+	first use, and again only after the ScriptModule changed or invalidated
+	its resolved handlers - that is, when its resolved handler token changed
+	- so events do not look the name up each time.
 */
 class ScriptFunctor
 {
 public:
-	ScriptFunctor(const String& functionName) : scriptFunctionName(functionName) {}
-    ScriptFunctor(const ScriptFunctor& obj) : scriptFunctionName(obj.scriptFunctionName) {}
+	ScriptFunctor(const String& functionName) :
+        scriptFunctionName(functionName),
+        d_token(0),
+        d_handle(ScriptModule::NoResolvedHandler)
+    {}
+    ScriptFunctor(const ScriptFunctor& obj) :
+        scriptFunctionName(obj.scriptFunctionName),
+        d_token(obj.d_token),
+        d_handle(obj.d_handle)
+    {}
 	bool	operator()(const EventArgs& e) const;
 
 private:
@@ -216,6 +294,11 @@ private:
     ScriptFunctor& operator=(const ScriptFunctor& rhs);
 
 	const String	scriptFunctionName;
+    //! resolved handler token of the module that the function was last
+    //! resolved with, at that time; 0 if never resolved.
+    mutable uint d_token;
+    //! the resolved function, or ScriptModule::NoResolvedHandler.
+    mutable int d_handle;
 };
 
 }
\ No newline at end of file
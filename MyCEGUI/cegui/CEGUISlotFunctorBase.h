@@ -11,6 +11,13 @@ class SlotFunctorBase
 public:
     virtual ~SlotFunctorBase() {};
     virtual bool operator()(const EventArgs& args) = 0;
+    /*!
+    \brief
+        Construct a copy of this functor at \a buffer and return it.  Used by
+        SubscriberSlot to copy functors held in its own storage; \a buffer is
+        suitably sized and aligned for the concrete functor type.
+    */
+    virtual SlotFunctorBase* copyTo(void* buffer) const = 0;
 };
 
 
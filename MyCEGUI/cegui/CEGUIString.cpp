@@ -2,12 +2,121 @@
 
 #include <iostream>
 
+// The bulk conversions below process sixteen code units at a time with SSE2
+// where the target has it, which every x86-64 target does.  Define
+// CEGUI_NO_SIMD to use the plain per code unit loops instead.
+#if !defined(CEGUI_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#   define CEGUI_STRING_SSE2
+#   include <emmintrin.h>
+#endif
+
 namespace CEGUI
 {
 
 // definition of 'no position' valueܶf
 const String::size_type String::npos = (String::size_type)(-1);
 
+#ifdef CEGUI_STRING_SSE2
+// zero extend the 16 bytes in \a bytes to the 16 utf32 at \a dest.
+static inline void widen16(__m128i bytes, utf32* dest)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+	const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+	__m128i* const out = reinterpret_cast<__m128i*>(dest);
+
+	_mm_storeu_si128(out, _mm_unpacklo_epi16(lo, zero));
+	_mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+	_mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+	_mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+}
+#endif
+
+// return the number of bytes below 0x80 at the start of \a src.
+static size_t asciiLength(const utf8* src, size_t len)
+{
+	size_t i = 0;
+
+#ifdef CEGUI_STRING_SSE2
+	for (; i + 16 <= len; i += 16)
+	{
+		const __m128i bytes =
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+		// the top bit of each byte is set for all but ASCII.
+		if (_mm_movemask_epi8(bytes))
+			break;
+	}
+#endif
+
+	while (i < len && src[i] < 0x80)
+		++i;
+
+	return i;
+}
+
+// copy the bytes below 0x80 at the start of \a src to \a dest as utf32,
+// returning how many there were.
+static size_t widenASCII(const utf8* src, utf32* dest, size_t len)
+{
+	size_t i = 0;
+
+#ifdef CEGUI_STRING_SSE2
+	for (; i + 16 <= len; i += 16)
+	{
+		const __m128i bytes =
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+		if (_mm_movemask_epi8(bytes))
+			break;
+
+		widen16(bytes, dest + i);
+	}
+#endif
+
+	for (; i < len && src[i] < 0x80; ++i)
+		dest[i] = src[i];
+
+	return i;
+}
+
+// copy the code points below 0x80 at the start of \a src to \a dest as
+// utf8, returning how many there were.
+static size_t narrowASCII(const utf32* src, utf8* dest, size_t len)
+{
+	size_t i = 0;
+
+#ifdef CEGUI_STRING_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i non_ascii = _mm_set1_epi32(~0x7F);
+
+	for (; i + 16 <= len; i += 16)
+	{
+		const __m128i* const in = reinterpret_cast<const __m128i*>(src + i);
+		const __m128i a = _mm_loadu_si128(in);
+		const __m128i b = _mm_loadu_si128(in + 1);
+		const __m128i c = _mm_loadu_si128(in + 2);
+		const __m128i d = _mm_loadu_si128(in + 3);
+
+		const __m128i any = _mm_and_si128(
+			_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), non_ascii);
+
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, zero)) != 0xFFFF)
+			break;
+
+		// all values are below 0x80, so neither pack saturates.
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i),
+			_mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+	}
+#endif
+
+	for (; i < len && src[i] < 0x80; ++i)
+		dest[i] = static_cast<utf8>(src[i]);
+
+	return i;
+}
+
 String::~String(void)
 {
 	if (d_reserve > STR_QUICKBUFF_SIZE)
@@ -25,13 +134,19 @@ bool String::grow(size_type new_size)
 {
 	// check for too big
 	if (max_size() <= new_size)
-		std::length_error("Resulting CEGUI::String would be too big");
+		CEGUI_THROW(std::length_error("Resulting CEGUI::String would be too big"));
 
 	// increase, as we always null-terminate the buffer.ΪԤλ
 	++new_size;
 
 	if (new_size > d_reserve)//³ȴԤλʱٽз䴦
 	{
+		// grow geometrically, so that repeated appends are amortised linear.
+		// the first allocation is exact, since most strings never grow again.
+		if (d_reserve > STR_QUICKBUFF_SIZE)
+			new_size = ceguimax(new_size,
+			                    ceguimin(max_size(), d_reserve + d_reserve / 2));
+
 		utf32* temp = new utf32[new_size];
 
 		if (d_reserve > STR_QUICKBUFF_SIZE) //жʵݴ
@@ -86,7 +201,7 @@ void String::trim(void)
 utf8* String::build_utf8_buff(void) const
 {
 	//utf32תΪutf8Ļ
-	size_type buffsize = encoded_size(ptr(), d_cplength) + 1;
+	size_type buffsize = encoded_size(buffer(), d_cplength) + 1;
 
 	if (buffsize > d_encodedbufflen) {
 
@@ -99,16 +214,251 @@ utf8* String::build_utf8_buff(void) const
 		d_encodedbufflen = buffsize;
 	}
 
-	encode(ptr(), d_encodedbuff, buffsize, d_cplength);
+	encode(buffer(), d_encodedbuff, buffsize, d_cplength);
 
 	// always add a null at end
 	d_encodedbuff[buffsize-1] = ((utf8)0);
-	d_encodeddatlen = buffsize;
+	// an encoding that may go out of date unnoticed is never reused.
+	if (d_encodeddatlen != npos)
+		d_encodeddatlen = buffsize;
 
 	return d_encodedbuff;
 }
 
 
+String::size_type String::encode(const utf32* src, utf8* dest, size_type dest_len, size_type src_len) const
+{
+	// count length for null terminated source...
+	if (src_len == 0)
+	{
+		src_len = utf_length(src);
+	}
+
+	size_type destCapacity = dest_len;
+
+	// while there is data in the source buffer,
+	for (size_type idx = 0; idx < src_len;)
+	{
+		utf32	cp = src[idx];
+
+		// copy runs of ASCII directly.
+		if (cp < 0x80)
+		{
+			const size_type run = narrowASCII(&src[idx], dest,
+				ceguimin(src_len - idx, destCapacity));
+
+			if (run == 0)
+			{
+				break;
+			}
+
+			idx += run;
+			dest += run;
+			destCapacity -= run;
+			continue;
+		}
+
+		// check there is enough destination buffer to receive this encoded unit (exit loop & return if not)
+		if (destCapacity < encoded_size(cp))
+		{
+			break;
+		}
+
+		++idx;
+
+		if (cp < 0x0800)
+		{
+			*dest++ = (utf8)((cp >> 6) | 0xC0);
+			*dest++ = (utf8)((cp & 0x3F) | 0x80);
+			destCapacity -= 2;
+		}
+		else if (cp < 0x10000)
+		{
+			*dest++ = (utf8)((cp >> 12) | 0xE0);
+			*dest++ = (utf8)(((cp >> 6) & 0x3F) | 0x80);
+			*dest++ = (utf8)((cp & 0x3F) | 0x80);
+			destCapacity -= 3;
+		}
+		else
+		{
+			*dest++ = (utf8)((cp >> 18) | 0xF0);
+			*dest++ = (utf8)(((cp >> 12) & 0x3F) | 0x80);
+			*dest++ = (utf8)(((cp >> 6) & 0x3F) | 0x80);
+			*dest++ = (utf8)((cp & 0x3F) | 0x80);
+			destCapacity -= 4;
+		}
+	}
+
+	return dest_len - destCapacity;
+}
+
+String::size_type String::encode(const utf8* src, utf32* dest, size_type dest_len, size_type src_len) const
+{
+	// count length for null terminated source...
+	if (src_len == 0)
+	{
+		src_len = utf_length(src);
+	}
+
+	size_type destCapacity = dest_len;
+
+	// while there is data in the source buffer, and space in the dest buffer
+	for (size_type idx = 0; ((idx < src_len) && (destCapacity > 0));)
+	{
+		utf32	cp;
+		utf8	cu = src[idx];
+
+		// copy runs of ASCII directly.
+		if (cu < 0x80)
+		{
+			const size_type run = widenASCII(&src[idx], dest,
+				ceguimin(src_len - idx, destCapacity));
+
+			idx += run;
+			dest += run;
+			destCapacity -= run;
+			continue;
+		}
+
+		++idx;
+
+		if (cu < 0xE0)
+		{
+			cp = ((cu & 0x1F) << 6);
+			cp |= (src[idx++] & 0x3F);
+		}
+		else if (cu < 0xF0)
+		{
+			cp = ((cu & 0x0F) << 12);
+			cp |= ((src[idx++] & 0x3F) << 6);
+			cp |= (src[idx++] & 0x3F);
+		}
+		else
+		{
+			cp = ((cu & 0x07) << 18);
+			cp |= ((src[idx++] & 0x3F) << 12);
+			cp |= ((src[idx++] & 0x3F) << 6);
+			cp |= (src[idx++] & 0x3F);
+		}
+
+		*dest++ = cp;
+		--destCapacity;
+	}
+
+	return dest_len - destCapacity;
+}
+
+String::size_type String::encoded_size(const utf32* buf, size_type len) const
+{
+	size_type count = 0;
+	size_type idx = 0;
+
+#ifdef CEGUI_STRING_SSE2
+	// each code point takes four bytes, less one for each of 0x80, 0x800 and
+	// 0x10000 that it is below; the lanes of 'below' count those.
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i from2 = _mm_set1_epi32(~0x7F);
+	const __m128i from3 = _mm_set1_epi32(~0x7FF);
+	const __m128i from4 = _mm_set1_epi32(~0xFFFF);
+	__m128i below = zero;
+
+	for (; idx + 4 <= len; idx += 4)
+	{
+		const __m128i cp =
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + idx));
+
+		// each comparison is -1 in the lanes below the threshold.
+		below = _mm_sub_epi32(below,
+			_mm_cmpeq_epi32(_mm_and_si128(cp, from2), zero));
+		below = _mm_sub_epi32(below,
+			_mm_cmpeq_epi32(_mm_and_si128(cp, from3), zero));
+		below = _mm_sub_epi32(below,
+			_mm_cmpeq_epi32(_mm_and_si128(cp, from4), zero));
+	}
+
+	uint32 lanes[4];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), below);
+
+	count = idx * 4 - lanes[0] - lanes[1] - lanes[2] - lanes[3];
+#endif
+
+	for (; idx < len; ++idx)
+	{
+		count += encoded_size(buf[idx]);
+	}
+
+	return count;
+}
+
+String::size_type String::encoded_size(const utf8* buf, size_type len) const
+{
+	utf8 tcp;
+	size_type count = 0;
+
+	while (len)
+	{
+		tcp = *buf;
+
+		// count runs of ASCII directly.
+		if (tcp < 0x80)
+		{
+			const size_type run = asciiLength(buf, len);
+			count += run;
+			buf += run;
+			len -= run;
+			continue;
+		}
+
+		++buf;
+		--len;
+		++count;
+		size_type size;
+
+		if (tcp < 0xE0)
+		{
+			size = 1;
+		}
+		else if (tcp < 0xF0)
+		{
+			size = 2;
+		}
+		else
+		{
+			size = 3;
+		}
+
+		// a sequence cut short by the end of the buffer ends the count.
+		if (len >= size)
+		{
+			len -= size;
+			buf += size;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	return count;
+}
+
+void String::widen(const char* chars, utf32* dest, size_type len)
+{
+	const utf8* const src = reinterpret_cast<const utf8*>(chars);
+	size_type i = 0;
+
+#ifdef CEGUI_STRING_SSE2
+	for (; i + 16 <= len; i += 16)
+		widen16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)),
+			dest + i);
+#endif
+
+	for (; i < len; ++i)
+	{
+		dest[i] = src[i];
+	}
+}
+
 bool	operator==(const String& str1, const String& str2)
 {
 	return (str1.compare(str2) == 0);
@@ -390,12 +740,38 @@ String operator+(const char* c_str, const String& str)
 	return tmp;
 }
 
+#ifdef CEGUI_HAS_MOVE_SEMANTICS
+String operator+(String&& str1, const String& str2)
+{
+	str1.append(str2);
+	return static_cast<String&&>(str1);
+}
+
+String operator+(String&& str, const utf8* utf8_str)
+{
+	str.append(utf8_str);
+	return static_cast<String&&>(str);
+}
+
+String operator+(String&& str, utf32 code_point)
+{
+	str.append(1, code_point);
+	return static_cast<String&&>(str);
+}
+
+String operator+(String&& str, const char* c_str)
+{
+	str.append(c_str);
+	return static_cast<String&&>(str);
+}
+#endif
+
 std::ostream& operator<<(std::ostream& s, const String& str)
 {
 	return s << str.c_str();
 }
 
-void	swap(String& str1, String& str2)
+void	swap(String& str1, String& str2) CEGUI_NOEXCEPT
 {
 	str1.swap(str2);
 }
@@ -9,7 +9,9 @@ namespace CEGUI
 {
 
 //ڿٷַ
+#ifndef STR_QUICKBUFF_SIZE
 #define STR_QUICKBUFF_SIZE	32
+#endif
 	typedef		uint8	utf8;
 	//typedef		uint16	utf16;  // removed typedef to prevent usage, as utf16 is not supported (yet)
 	typedef		uint32	utf32;
@@ -41,7 +43,7 @@ private:
 	size_type	d_reserve;			//!< code point reserve size (currently allocated buffer size in code points).
 
 	mutable utf8*		d_encodedbuff;		//!< holds string data encoded as utf8 (generated only by calls to c_str() and data())
-	mutable size_type	d_encodeddatlen;	//!< holds length of encoded data (in case it's smaller than buffer).
+	mutable size_type	d_encodeddatlen;	//!< holds length of encoded data (in case it's smaller than buffer), 0 if it is out of date, or npos if it may go out of date unnoticed (see data()).
 	mutable size_type	d_encodedbufflen;	//!< length of above buffer (since buffer can be bigger then the data it holds to save re-allocations).
 
 	utf32		d_quickbuff[STR_QUICKBUFF_SIZE];	//!< This is a integrated 'quick' buffer to save allocations for smallish strings
@@ -281,7 +283,7 @@ public:
             const size_t la = a.length();
             const size_t lb = b.length();
             if (la == lb)
-                return (memcmp(a.ptr(), b.ptr(), la*sizeof(utf32)) < 0);
+                return (memcmp(a.buffer(), b.buffer(), la*sizeof(utf32)) < 0);
             return (la < lb);
         }
     };
@@ -299,6 +301,15 @@ public:
 		assign(str);
 	}
 
+#ifdef CEGUI_HAS_MOVE_SEMANTICS
+	//! Move constructor.  \a str is left empty.
+	String(String&& str) CEGUI_NOEXCEPT
+	{
+		init();
+		swap(str);
+	}
+#endif
+
 	String(const String& str, size_type str_idx, size_type str_num = npos)
 	{
 		init();
@@ -418,7 +429,7 @@ public:
 		if ((str_len == npos) || (str_idx + str_len > str.d_cplength))
 			str_len = str.d_cplength - str_idx;
 
-		int val = (len == 0) ? 0 : utf32_comp_utf32(&ptr()[idx], &str.ptr()[str_idx], (len < str_len) ? len : str_len);
+		int val = (len == 0) ? 0 : utf32_comp_utf32(&buffer()[idx], &str.buffer()[str_idx], (len < str_len) ? len : str_len);
 
 		return (val != 0) ? ((val < 0) ? -1 : 1) : (len < str_len) ? -1 : (len == str_len) ? 0 : 1;
 	}
@@ -444,7 +455,7 @@ public:
 		if ((str_len == npos) || (str_idx + str_len > std_str.size()))
 			str_len = (size_type)std_str.size() - str_idx;
 
-		int val = (len == 0) ? 0 : utf32_comp_char(&ptr()[idx], &std_str.c_str()[str_idx], (len < str_len) ? len : str_len);
+		int val = (len == 0) ? 0 : utf32_comp_char(&buffer()[idx], &std_str.c_str()[str_idx], (len < str_len) ? len : str_len);
 
 		return (val != 0) ? ((val < 0) ? -1 : 1) : (len < str_len) ? -1 : (len == str_len) ? 0 : 1;
 	}
@@ -475,7 +486,7 @@ public:
 		if ((len == npos) || (idx + len > d_cplength))
 			len = d_cplength - idx;
 
-		int val = (len == 0) ? 0 : utf32_comp_utf8(&ptr()[idx], utf8_str, (len < str_cplen) ? len : str_cplen);
+		int val = (len == 0) ? 0 : utf32_comp_utf8(&buffer()[idx], utf8_str, (len < str_cplen) ? len : str_cplen);
 
 		return (val != 0) ? ((val < 0) ? -1 : 1) : (len < str_cplen) ? -1 : (len == str_cplen) ? 0 : 1;
 	}
@@ -504,7 +515,7 @@ public:
 		if ((len == npos) || (idx + len > d_cplength))
 			len = d_cplength - idx;
 
-		int val = (len == 0) ? 0 : utf32_comp_char(&ptr()[idx], chars, (len < chars_len) ? len : chars_len);
+		int val = (len == 0) ? 0 : utf32_comp_char(&buffer()[idx], chars, (len < chars_len) ? len : chars_len);
 
 		return (val != 0) ? ((val < 0) ? -1 : 1) : (len < chars_len) ? -1 : (len == chars_len) ? 0 : 1;
 	}
@@ -518,7 +529,7 @@ public:
 	//const󷵻ֵ
 	value_type	operator[](size_type idx) const
 	{
-		return ptr()[idx];
+		return buffer()[idx];
 	}
 
 	//exception std::out_of_range	Thrown if \a idx is >= length().
@@ -536,30 +547,44 @@ public:
 		if (d_cplength <= idx)
 			CEGUI_THROW(std::out_of_range("Index is out of range for CEGUI::String"));
 
-		return ptr()[idx];
+		return buffer()[idx];
 	}
 
 	//utf8ַ
 	const char* c_str(void) const
 	{
-		return (const char*)build_utf8_buff();
+		return (const char*)data();
 	}
 
+	/*!
+	\brief
+		Return the string encoded as utf8.  The encoding is built on the first
+		call and kept until the string is next modified, so repeated calls
+		cost nothing.
+
+	\note
+		Once a non-const iterator, reference or pointer into the code points
+		has been handed out, the string can be changed without it knowing, so
+		from then on the encoding is rebuilt on every call, until the whole
+		content is replaced by an assignment or clear().
+	*/
 	const utf8* data(void) const
 	{
-		return build_utf8_buff();
+		return (d_encodeddatlen != 0 && d_encodeddatlen != npos) ? d_encodedbuff : build_utf8_buff();
 	}
 
     //ʹеĻָ
 	utf32*	ptr(void)
 	{
-		return (d_reserve > STR_QUICKBUFF_SIZE) ? d_buffer : d_quickbuff;
+		// the caller may write through the pointer at any later time.
+		d_encodeddatlen = npos;
+		return buffer();
 	}
 
 	//const
 	const utf32*	ptr(void) const
 	{
-		return (d_reserve > STR_QUICKBUFF_SIZE) ? d_buffer : d_quickbuff;
+		return buffer();
 	}
 
 	// copy, at most, 'len' code-points of the string, begining with code-point 'idx', into the array 'buf' as valid utf8 encoded data
@@ -573,7 +598,7 @@ public:
 		if (len == npos)
 			len = d_cplength;
 
-		return encode(&ptr()[idx], buf, npos, len);
+		return encode(&buffer()[idx], buf, npos, len);
 	}
 
 	//The number of utf8 code units (bytes) required to hold the specified sub-string when encoded as utf8 data.
@@ -587,7 +612,7 @@ public:
 
 		size_type	maxlen = d_cplength - idx;
 
-		return encoded_size(&ptr()[idx], ceguimin(num, maxlen));
+		return encoded_size(&buffer()[idx], ceguimin(num, maxlen));
 	}
 
 	String&	operator=(const String& str)
@@ -595,6 +620,22 @@ public:
 		return assign(str);
 	}
 
+#ifdef CEGUI_HAS_MOVE_SEMANTICS
+	//! Move assignment.  \a str is left holding the previous contents.
+	String&	operator=(String&& str) CEGUI_NOEXCEPT
+	{
+		const bool exposed = (str.d_encodeddatlen == npos);
+		swap(str);
+
+		// our previous content went to \a str; only what \a str handed out
+		// still reaches into ours.
+		if (!exposed)
+			d_encodeddatlen = 0;
+
+		return *this;
+	}
+#endif
+
 	//exception std::out_of_range	Thrown if str_idx is invalid for \a str
 	String&	assign(const String& str, size_type str_idx = 0, size_type str_num = npos)
 	{
@@ -604,9 +645,10 @@ public:
 		if ((str_num == npos) || (str_num > str.d_cplength - str_idx)) //ҪƵĳ
 			str_num = str.d_cplength - str_idx;
 
+		replaced();
 		grow(str_num);
 		setlen(str_num);
-		memcpy(ptr(), &str.ptr()[str_idx], str_num * sizeof(utf32));
+		memcpy(buffer(), &str.buffer()[str_idx], str_num * sizeof(utf32));
 
 		return *this;
 	}
@@ -627,12 +669,14 @@ public:
 		if ((str_num == npos) || (str_num > (size_type)std_str.size() - str_idx))
 			str_num = (size_type)std_str.size() - str_idx;
 
+		replaced();
 		grow(str_num);
 		setlen(str_num);
+		utf32* p = buffer();
 
 		while(str_num--) //ŸƣͲƥ䣬ҪһתûжԶֽڱд
 		{
-			((*this)[str_num]) = static_cast<utf32>(static_cast<unsigned char>(std_str[str_num + str_idx]));
+			p[str_num] = static_cast<utf32>(static_cast<unsigned char>(std_str[str_num + str_idx]));
 		}
 
 		return *this;
@@ -660,9 +704,10 @@ public:
 
 		size_type enc_sze = encoded_size(utf8_str, str_num);
 
+		replaced();
 		grow(enc_sze);
 		//ʱd_reserveĻ
-		encode(utf8_str, ptr(), d_reserve, str_num);
+		encode(utf8_str, buffer(), d_reserve, str_num);
 		setlen(enc_sze);
 		return *this;
 	}
@@ -678,9 +723,10 @@ public:
 		if (num == npos)
 			CEGUI_THROW(std::length_error("Code point count can not be 'npos'"));
 
+		replaced();
 		grow(num);
 		setlen(num);
-		utf32* p = ptr();
+		utf32* p = buffer();
 
 		while(num--)
 			*p++ = code_point;
@@ -703,19 +749,14 @@ public:
 	//exception std::length_error	Thrown if the resulting String would have been too large.
 	String&	assign(const char* chars, size_type chars_len)
 	{
+		replaced();
 		grow(chars_len);
-		utf32* pt = ptr();
-
-		for (size_type i = 0; i < chars_len; ++i)
-		{
-			*pt++ = static_cast<utf32>(static_cast<unsigned char>(*chars++));
-		}
-
+		widen(chars, buffer(), chars_len);
 		setlen(chars_len);
 		return *this;
 	}
 
-	void	swap(String& str)
+	void	swap(String& str) CEGUI_NOEXCEPT
 	{
 		size_type	temp_len	= d_cplength;
 		d_cplength = str.d_cplength;
@@ -729,8 +770,25 @@ public:
 		d_buffer = str.d_buffer;
 		str.d_buffer = temp_buf;
 
+		// the utf8 encodings, if any, go with the strings.
+		utf8*		temp_enc	= d_encodedbuff;
+		d_encodedbuff = str.d_encodedbuff;
+		str.d_encodedbuff = temp_enc;
+
+		size_type	temp_elen	= d_encodeddatlen;
+		d_encodeddatlen = str.d_encodeddatlen;
+		str.d_encodeddatlen = temp_elen;
+
+		size_type	temp_eblen	= d_encodedbufflen;
+		d_encodedbufflen = str.d_encodedbufflen;
+		str.d_encodedbufflen = temp_eblen;
+
+		// outstanding iterators now reach into either string.
+		if (d_encodeddatlen == npos || str.d_encodeddatlen == npos)
+			d_encodeddatlen = str.d_encodeddatlen = npos;
+
 		// see if we need to swap 'quick buffer' data
-		if (temp_res <= STR_QUICKBUFF_SIZE)
+		if (temp_res <= STR_QUICKBUFF_SIZE || d_reserve <= STR_QUICKBUFF_SIZE)
 		{
 			utf32		temp_qbf[STR_QUICKBUFF_SIZE];
 
@@ -758,7 +816,7 @@ public:
 			str_num = str.d_cplength - str_idx;
 
 		grow(d_cplength + str_num);
-		memcpy(&ptr()[d_cplength], &str.ptr()[str_idx], str_num * sizeof(utf32));
+		memcpy(&buffer()[d_cplength], &str.buffer()[str_idx], str_num * sizeof(utf32));
 		setlen(d_cplength + str_num);
 		return *this;
 	}
@@ -782,7 +840,7 @@ public:
 		size_type newsze = d_cplength + str_num;
 
 		grow(newsze);
-		utf32* pt = &ptr()[newsze-1];
+		utf32* pt = &buffer()[newsze-1];
 
 		while(str_num--)
 			*pt-- = static_cast<utf32>(static_cast<unsigned char>(std_str[str_num]));
@@ -813,7 +871,7 @@ public:
 		size_type newsz = d_cplength + encsz;
 
 		grow(newsz);
-		encode(utf8_str, &ptr()[d_cplength], encsz, len);
+		encode(utf8_str, &buffer()[d_cplength], encsz, len);
 		setlen(newsz);
 
 		return *this;
@@ -834,7 +892,7 @@ public:
 		size_type newsz = d_cplength + num;
 		grow(newsz);
 
-		utf32* p = &ptr()[d_cplength];
+		utf32* p = &buffer()[d_cplength];
 
 		while(num--)
 			*p++ = code_point;
@@ -854,7 +912,8 @@ public:
 	//exception std::length_error	Thrown if the resulting string would be too large.
 	String&	append(const_iterator iter_beg, const_iterator iter_end)
 	{
-		return replace(end(), end(), iter_beg, iter_end);
+		iterator pos(&buffer()[d_cplength]);
+		return replace(pos, pos, iter_beg, iter_end);
 	}
 
 	//exception std::length_error	Thrown if resulting String would be too large.
@@ -878,12 +937,7 @@ public:
 		size_type newsz = d_cplength + chars_len;
 
 		grow(newsz);
-
-		utf32* pt = &ptr()[newsz-1];
-
-		while(chars_len--)
-			*pt-- = static_cast<utf32>(static_cast<unsigned char>(chars[chars_len]));
-
+		widen(chars, &buffer()[d_cplength], chars_len);
 		setlen(newsz);
 
 		return *this;
@@ -908,8 +962,8 @@ public:
 
 		size_type newsz = d_cplength + str_num;
 		grow(newsz);
-		memmove(&ptr()[idx + str_num], &ptr()[idx], (d_cplength - idx) * sizeof(utf32));
-		memcpy(&ptr()[idx], &str.ptr()[str_idx], str_num * sizeof(utf32));
+		memmove(&buffer()[idx + str_num], &buffer()[idx], (d_cplength - idx) * sizeof(utf32));
+		memcpy(&buffer()[idx], &str.buffer()[str_idx], str_num * sizeof(utf32));
 		setlen(newsz);
 
 		return *this;
@@ -938,9 +992,9 @@ public:
 		size_type newsz = d_cplength + str_num;
 		grow(newsz);
 
-		memmove(&ptr()[idx + str_num], &ptr()[idx], (d_cplength - idx) * sizeof(utf32));
+		memmove(&buffer()[idx + str_num], &buffer()[idx], (d_cplength - idx) * sizeof(utf32));
 
-		utf32* pt = &ptr()[idx + str_num - 1];
+		utf32* pt = &buffer()[idx + str_num - 1];
 
 		while(str_num--)
 			*pt-- = static_cast<utf32>(static_cast<unsigned char>(std_str[str_idx + str_num]));
@@ -971,8 +1025,8 @@ public:
 		size_type newsz = d_cplength + encsz;
 
 		grow(newsz);
-		memmove(&ptr()[idx + encsz], &ptr()[idx], (d_cplength - idx) * sizeof(utf32));
-		encode(utf8_str, &ptr()[idx], encsz, len);
+		memmove(&buffer()[idx + encsz], &buffer()[idx], (d_cplength - idx) * sizeof(utf32));
+		encode(utf8_str, &buffer()[idx], encsz, len);
 		setlen(newsz);
 
 		return *this;
@@ -991,9 +1045,9 @@ public:
 		size_type newsz = d_cplength + num;
 		grow(newsz);
 
-		memmove(&ptr()[idx + num], &ptr()[idx], (d_cplength - idx) * sizeof(utf32));
+		memmove(&buffer()[idx + num], &buffer()[idx], (d_cplength - idx) * sizeof(utf32));
 
-		utf32* pt = &ptr()[idx + num - 1];
+		utf32* pt = &buffer()[idx + num - 1];
 
 		while(num--)
 			*pt-- = code_point;
@@ -1042,9 +1096,9 @@ public:
 		size_type newsz = d_cplength + chars_len;
 
 		grow(newsz);
-		memmove(&ptr()[idx + chars_len], &ptr()[idx], (d_cplength - idx) * sizeof(utf32));
+		memmove(&buffer()[idx + chars_len], &buffer()[idx], (d_cplength - idx) * sizeof(utf32));
 
-		utf32* pt = &ptr()[idx + chars_len - 1];
+		utf32* pt = &buffer()[idx + chars_len - 1];
 
 		while(chars_len--)
 			*pt-- = static_cast<utf32>(static_cast<unsigned char>(chars[chars_len]));
@@ -1056,6 +1110,7 @@ public:
 
 	void	clear(void)
 	{
+		replaced();
 		setlen(0);
 		trim();
 	}
@@ -1088,7 +1143,7 @@ public:
 		size_type newsz = d_cplength - len;
 
 		//ûзı
-		memmove(&ptr()[idx], &ptr()[idx + len], (d_cplength - idx - len) * sizeof(utf32));
+		memmove(&buffer()[idx], &buffer()[idx + len], (d_cplength - idx - len) * sizeof(utf32));
 		setlen(newsz);
 		return	*this;
 	}
@@ -1154,9 +1209,9 @@ public:
 		grow(newsz);
 
 		if ((idx + len) < d_cplength)
-			memmove(&ptr()[idx + str_num], &ptr()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
+			memmove(&buffer()[idx + str_num], &buffer()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
 
-		memcpy(&ptr()[idx], &str.ptr()[str_idx], str_num * sizeof(utf32));
+		memcpy(&buffer()[idx], &str.buffer()[str_idx], str_num * sizeof(utf32));
 		setlen(newsz);
 
 		return *this;
@@ -1196,9 +1251,9 @@ public:
 		grow(newsz);
 
 		if ((idx + len) < d_cplength)
-			memmove(&ptr()[idx + str_num], &ptr()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
+			memmove(&buffer()[idx + str_num], &buffer()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
 
-		utf32* pt = &ptr()[idx + str_num - 1];
+		utf32* pt = &buffer()[idx + str_num - 1];
 
 		while (str_num--)
 			*pt-- = static_cast<utf32>(static_cast<unsigned char>(std_str[str_idx + str_num]));
@@ -1240,9 +1295,9 @@ public:
 		grow(newsz);
 
 		if ((idx + len) < d_cplength)
-			memmove(&ptr()[idx + encsz], &ptr()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
+			memmove(&buffer()[idx + encsz], &buffer()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
 
-		encode(utf8_str, &ptr()[idx], encsz, str_len);
+		encode(utf8_str, &buffer()[idx], encsz, str_len);
 
 		setlen(newsz);
 		return *this;
@@ -1272,9 +1327,9 @@ public:
 		grow(newsz);
 
 		if ((idx + len) < d_cplength)
-			memmove(&ptr()[idx + num], &ptr()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
+			memmove(&buffer()[idx + num], &buffer()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
 
-		utf32* pt = &ptr()[idx + num - 1];
+		utf32* pt = &buffer()[idx + num - 1];
 
 		while (num--)
 			*pt-- = code_point;
@@ -1313,9 +1368,9 @@ public:
 
 			//idx+len֮
 			if ((idx + len) < d_cplength)
-				memmove(&ptr()[idx + str_len], &ptr()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
+				memmove(&buffer()[idx + str_len], &buffer()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
 
-			memcpy(&ptr()[idx], iter_newBeg.d_ptr, str_len * sizeof(utf32));
+			memcpy(&buffer()[idx], iter_newBeg.d_ptr, str_len * sizeof(utf32));
 			setlen(newsz);
 		}
 
@@ -1353,9 +1408,9 @@ public:
 		grow(newsz);
 
 		if ((idx + len) < d_cplength)
-			memmove(&ptr()[idx + chars_len], &ptr()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
+			memmove(&buffer()[idx + chars_len], &buffer()[len + idx], (d_cplength - idx - len) * sizeof(utf32));
 
-		utf32* pt = &ptr()[idx + chars_len - 1];
+		utf32* pt = &buffer()[idx + chars_len - 1];
 
 		while (chars_len--)
 			*pt-- = static_cast<utf32>(static_cast<unsigned char>(chars[chars_len]));
@@ -1374,7 +1429,7 @@ public:
 	{
 		if (idx < d_cplength)
 		{
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			while (idx < d_cplength)
 			{
@@ -1396,7 +1451,7 @@ public:
 
 		if (d_cplength > 0)
 		{
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1634,7 +1689,7 @@ public:
 	{
 		if (idx < d_cplength)
 		{
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1652,7 +1707,7 @@ public:
 	{
 		if (idx < d_cplength)
 		{
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1670,7 +1725,7 @@ public:
 	{
 		if (idx < d_cplength)
 		{
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1688,7 +1743,7 @@ public:
 	{
 		if (idx < d_cplength)
 		{
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1724,7 +1779,7 @@ public:
 		{
 			size_type encsze = encoded_size(utf8_str, str_len);
 
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1748,7 +1803,7 @@ public:
 		{
 			size_type encsze = encoded_size(utf8_str, str_len);
 
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1804,7 +1859,7 @@ public:
 
 		if (idx < d_cplength)
 		{
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1826,7 +1881,7 @@ public:
 
 		if (idx < d_cplength)
 		{
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1847,7 +1902,7 @@ public:
 			if (idx >= d_cplength)
 				idx = d_cplength - 1;
 
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1868,7 +1923,7 @@ public:
 			if (idx >= d_cplength)
 				idx = d_cplength - 1;
 
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1889,7 +1944,7 @@ public:
 			if (idx >= d_cplength)
 				idx = d_cplength - 1;
 
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1910,7 +1965,7 @@ public:
 			if (idx >= d_cplength)
 				idx = d_cplength - 1;
 
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1949,7 +2004,7 @@ public:
 
 			size_type encsze = encoded_size(utf8_str, str_len);
 
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -1976,7 +2031,7 @@ public:
 
 			size_type encsze = encoded_size(utf8_str, str_len);
 
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -2037,7 +2092,7 @@ public:
 			if (idx >= d_cplength)
 				idx = d_cplength - 1;
 
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -2062,7 +2117,7 @@ public:
 			if (idx >= d_cplength)
 				idx = d_cplength - 1;
 
-			const utf32* pt = &ptr()[idx];
+			const utf32* pt = &buffer()[idx];
 
 			do
 			{
@@ -2093,7 +2148,7 @@ public:
 
 	const_iterator	begin(void) const
 	{
-		return const_iterator(ptr());
+		return const_iterator(buffer());
 	}
 
 	//d_cplengthַȣβ0
@@ -2104,7 +2159,7 @@ public:
 
 	const_iterator	end(void) const
 	{
-		return const_iterator(&ptr()[d_cplength]);
+		return const_iterator(&buffer()[d_cplength]);
 	}
 
 	reverse_iterator		rbegin(void)
@@ -2128,12 +2183,35 @@ public:
 	}
 
 private:
+	// pointer to the buffer in use, for the String's own modifications.
+	utf32*	buffer(void)
+	{
+		// all modifications go through here, so the utf8 encoding is dropped;
+		// unless it is never reused anyway.
+		if (d_encodeddatlen != npos)
+			d_encodeddatlen = 0;
+		return (d_reserve > STR_QUICKBUFF_SIZE) ? d_buffer : d_quickbuff;
+	}
+
+	const utf32*	buffer(void) const
+	{
+		return (d_reserve > STR_QUICKBUFF_SIZE) ? d_buffer : d_quickbuff;
+	}
+
+	// the whole content is being replaced, which invalidates every iterator,
+	// reference and pointer handed out before, so the encoding may be reused
+	// again once built.
+	void	replaced(void)
+	{
+		d_encodeddatlen = 0;
+	}
+
     bool	grow(size_type new_size);
     void	trim(void);
 	void	setlen(size_type len)
 	{
 		d_cplength = len;
-		ptr()[len] = (utf32)(0);
+		buffer()[len] = (utf32)(0);
 	}
 	void	init(void)
 	{
@@ -2148,7 +2226,7 @@ private:
 	// return true if the given pointer is inside the string data
 	bool	inside(utf32* inptr)
 	{
-		if (inptr < ptr() || ptr() + d_cplength <= inptr)
+		if (inptr < buffer() || buffer() + d_cplength <= inptr)
 			return false;
 		else
 			return true;
@@ -2165,105 +2243,10 @@ private:
 	//	src_len is in code units, or 0 for null terminated string.
 	//	dest_len is in code units.
 	//	returns number of code units put into dest buffer.
-	size_type encode(const utf32* src, utf8* dest, size_type dest_len, size_type src_len = 0) const
-	{
-		// count length for null terminated source...
-		if (src_len == 0)
-		{
-			src_len = utf_length(src);
-		}
-
-		size_type destCapacity = dest_len;
-
-		// while there is data in the source buffer,
-		for (uint idx = 0; idx < src_len; ++idx)
-		{
-			utf32	cp = src[idx];
-
-			// check there is enough destination buffer to receive this encoded unit (exit loop & return if not)
-			if (destCapacity < encoded_size(cp))
-			{
-				break;
-			}
-
-			if (cp < 0x80)
-			{
-				*dest++ = (utf8)cp;
-				--destCapacity;
-			}
-			else if (cp < 0x0800)
-			{
-				*dest++ = (utf8)((cp >> 6) | 0xC0);
-				*dest++ = (utf8)((cp & 0x3F) | 0x80);
-				destCapacity -= 2;
-			}
-			else if (cp < 0x10000)
-			{
-				*dest++ = (utf8)((cp >> 12) | 0xE0);
-				*dest++ = (utf8)(((cp >> 6) & 0x3F) | 0x80);
-				*dest++ = (utf8)((cp & 0x3F) | 0x80);
-				destCapacity -= 3;
-			}
-			else
-			{
-				*dest++ = (utf8)((cp >> 18) | 0xF0);
-				*dest++ = (utf8)(((cp >> 12) & 0x3F) | 0x80);
-				*dest++ = (utf8)(((cp >> 6) & 0x3F) | 0x80);
-				*dest++ = (utf8)((cp & 0x3F) | 0x80);
-				destCapacity -= 4;
-			}
-
-		}
-
-		return dest_len - destCapacity;
-	}
+	size_type encode(const utf32* src, utf8* dest, size_type dest_len, size_type src_len = 0) const;
 
 	//תʣĻ
-	size_type encode(const utf8* src, utf32* dest, size_type dest_len, size_type src_len = 0) const
-	{
-		// count length for null terminated source...
-		if (src_len == 0)
-		{
-			src_len = utf_length(src);
-		}
-
-		size_type destCapacity = dest_len;
-
-		// while there is data in the source buffer, and space in the dest buffer
-		for (uint idx = 0; ((idx < src_len) && (destCapacity > 0));)
-		{
-			utf32	cp;
-			utf8	cu = src[idx++];
-
-			if (cu < 0x80)
-			{
-				cp = (utf32)(cu);
-			}
-			else if (cu < 0xE0)
-			{
-				cp = ((cu & 0x1F) << 6);
-				cp |= (src[idx++] & 0x3F);
-			}
-			else if (cu < 0xF0)
-			{
-				cp = ((cu & 0x0F) << 12);
-				cp |= ((src[idx++] & 0x3F) << 6);
-				cp |= (src[idx++] & 0x3F);
-			}
-			else
-			{
-				cp = ((cu & 0x07) << 18);
-				cp |= ((src[idx++] & 0x3F) << 12);
-				cp |= ((src[idx++] & 0x3F) << 6);
-				cp |= (src[idx++] & 0x3F);
-			}
-
-			*dest++ = cp;
-			--destCapacity;
-		}
-
-		return dest_len - destCapacity;
-	}
+	size_type encode(const utf8* src, utf32* dest, size_type dest_len, size_type src_len = 0) const;
 
 	//utf32ַӦutf8ַȳ
 	size_type encoded_size(utf32 code_point) const
@@ -2285,17 +2268,7 @@ private:
 	}
 
 	//utf32תΪutf8ĳ
-	size_type encoded_size(const utf32* buf, size_type len) const
-	{
-		size_type count = 0;
-
-		while (len--)
-		{
-			count += encoded_size(*buf++);
-		}
-
-		return count;
-	}
+	size_type encoded_size(const utf32* buf, size_type len) const;
 
 	//utf8תΪutf32ĳȣ
 	size_type encoded_size(const utf8* buf) const
@@ -2304,44 +2277,10 @@ private:
 	}
 
 	//utf8ַȣβ0
-	size_type encoded_size(const utf8* buf, size_type len) const
-	{
-		utf8 tcp;
-		size_type count = 0;
-
-		while (len--)
-		{
-			tcp = *buf++;
-			++count;
-			size_type size = 0;
+	size_type encoded_size(const utf8* buf, size_type len) const;
 
-			if (tcp < 0x80)
-			{
-			}
-			else if (tcp < 0xE0)
-			{
-				size = 1;
-				++buf;
-			}
-			else if (tcp < 0xF0)
-			{
-				size = 2;
-				buf += 2;
-			}
-			else
-			{
-				size = 3;
-				buf += 3;
-			}
-
-			if (len >= size)
-				len -= size;
-			else 
-				break;
-		}
-
-		return count;
-	}
+	// copy \a len chars to \a dest, taking each char as one code point.
+	static void widen(const char* chars, utf32* dest, size_type len);
 
 	//utf8ֽڳȣ0
 	size_type utf_length(const utf8* utf8_str) const
@@ -2566,7 +2505,14 @@ String operator+(utf32 code_point, const String& str);
 String operator+(const String& str, const char* c_str);
 //exception std::length_error	Thrown if the resulting String would be too large.
 String operator+(const char* c_str, const String& str);
+#ifdef CEGUI_HAS_MOVE_SEMANTICS
+// these append to the temporary \a str1, so chains of + build one String.
+String operator+(String&& str1, const String& str2);
+String operator+(String&& str, const utf8* utf8_str);
+String operator+(String&& str, utf32 code_point);
+String operator+(String&& str, const char* c_str);
+#endif
 std::ostream& operator<<(std::ostream& s, const String& str);
-void swap(String& str1, String& str2);
+void swap(String& str1, String& str2) CEGUI_NOEXCEPT;
 
 };
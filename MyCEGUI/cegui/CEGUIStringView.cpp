@@ -0,0 +1,117 @@
+#include "CEGUIStringView.h"
+
+#include <cstring>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+StringView::size_type StringView::length() const
+{
+    if (d_encoding != E_UTF8)
+        return d_units;
+
+    size_type count = 0;
+    for (size_type unit = 0; unit < d_units; ++count)
+        decodeUTF8(unit);
+
+    return count;
+}
+
+//----------------------------------------------------------------------------//
+String StringView::str() const
+{
+    if (d_encoding == E_CHAR)
+        return String(static_cast<const char*>(d_data), d_units);
+
+    String result;
+    result.reserve(length());
+
+    for (size_type unit = 0; unit < d_units;)
+        result += decode(unit);
+
+    return result;
+}
+
+//----------------------------------------------------------------------------//
+utf32 StringView::decodeUTF8(size_type& unit) const
+{
+    const utf8* const src = static_cast<const utf8*>(d_data);
+    const utf8 cu = src[unit++];
+
+    // number of continuation bytes and the bits of the lead byte, as
+    // String::encode reads them.
+    size_type count;
+    utf32 cp;
+
+    if (cu < 0x80)
+        return cu;
+    else if (cu < 0xE0)
+    {
+        count = 1;
+        cp = cu & 0x1F;
+    }
+    else if (cu < 0xF0)
+    {
+        count = 2;
+        cp = cu & 0x0F;
+    }
+    else
+    {
+        count = 3;
+        cp = cu & 0x07;
+    }
+
+    for (; count && unit < d_units; --count)
+        cp = (cp << 6) | (src[unit++] & 0x3F);
+
+    return cp;
+}
+
+//----------------------------------------------------------------------------//
+bool operator==(const StringView& lhs, const StringView& rhs)
+{
+    // views of the same encoding are compared unit by unit.
+    if (lhs.getEncoding() == rhs.getEncoding())
+    {
+        if (lhs.getUnitCount() != rhs.getUnitCount())
+            return false;
+
+        if (lhs.getEncoding() == StringView::E_UTF32)
+        {
+            const utf32* const l = static_cast<const utf32*>(lhs.data());
+            const utf32* const r = static_cast<const utf32*>(rhs.data());
+
+            for (StringView::size_type i = 0; i < lhs.getUnitCount(); ++i)
+                if (l[i] != r[i])
+                    return false;
+
+            return true;
+        }
+
+        return std::memcmp(lhs.data(), rhs.data(), lhs.getUnitCount()) == 0;
+    }
+
+    // a code point is at least one unit in any encoding, so a view of more
+    // UTF-32 or char units than the other view has units can not match.
+    if (lhs.getEncoding() != StringView::E_UTF8 &&
+        lhs.getUnitCount() > rhs.getUnitCount())
+        return false;
+
+    if (rhs.getEncoding() != StringView::E_UTF8 &&
+        rhs.getUnitCount() > lhs.getUnitCount())
+        return false;
+
+    StringView::size_type l = 0;
+    StringView::size_type r = 0;
+
+    while (l < lhs.getUnitCount() && r < rhs.getUnitCount())
+        if (lhs.decode(l) != rhs.decode(r))
+            return false;
+
+    return l == lhs.getUnitCount() && r == rhs.getUnitCount();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
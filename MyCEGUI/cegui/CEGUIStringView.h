@@ -0,0 +1,164 @@
+#pragma once
+
+#include "CEGUIBase.h"
+#include "CEGUIString.h"
+
+#include <cstring>
+
+namespace CEGUI
+{
+/*!
+\brief
+    Non-owning view of a sequence of code points held elsewhere, either as
+    UTF-32 - such as the contents of a String - or as UTF-8, or as chars
+    taken one code point each, as String takes them from a char string.
+
+    Functions that only look a name up take it as a StringView, so callers
+    holding a String pass it without a copy, and callers holding a literal
+    or a slice of a larger buffer pass it without decoding it into a String
+    first:
+
+    \code
+    Window* w = WindowManager::getSingleton().getWindow("Root/OK");
+    w->setProperty(reinterpret_cast<const utf8*>(name_buf), "True");
+    \endcode
+
+    The viewed code units are neither copied nor null terminated, so they
+    must outlive the view.
+*/
+class StringView
+{
+public:
+    typedef String::size_type size_type;
+
+    //! How the viewed code units encode code points.
+    enum Encoding
+    {
+        //! Each char is a code point, as for String(const char*).
+        E_CHAR,
+        //! UTF-8, as for String(const utf8*).
+        E_UTF8,
+        //! UTF-32.
+        E_UTF32
+    };
+
+    //! Construct a view of no code points.
+    StringView() :
+        d_data(0),
+        d_units(0),
+        d_encoding(E_UTF32)
+    {}
+
+    //! Construct a view of the contents of \a str.
+    StringView(const String& str) :
+        d_data(str.ptr()),
+        d_units(str.length()),
+        d_encoding(E_UTF32)
+    {}
+
+    //! Construct a view of \a std_str, one char per code point.
+    StringView(const std::string& std_str) :
+        d_data(std_str.data()),
+        d_units(std_str.length()),
+        d_encoding(E_CHAR)
+    {}
+
+    //! Construct a view of the null terminated \a cstr, one char per code
+    //! point.
+    StringView(const char* cstr) :
+        d_data(cstr),
+        d_units(std::strlen(cstr)),
+        d_encoding(E_CHAR)
+    {}
+
+    //! Construct a view of \a chars_len chars, one char per code point.
+    StringView(const char* chars, size_type chars_len) :
+        d_data(chars),
+        d_units(chars_len),
+        d_encoding(E_CHAR)
+    {}
+
+    //! Construct a view of the null terminated UTF-8 \a utf8_str.
+    StringView(const utf8* utf8_str) :
+        d_data(utf8_str),
+        d_units(std::strlen(reinterpret_cast<const char*>(utf8_str))),
+        d_encoding(E_UTF8)
+    {}
+
+    //! Construct a view of the \a bytes bytes of UTF-8 at \a utf8_str.
+    StringView(const utf8* utf8_str, size_type bytes) :
+        d_data(utf8_str),
+        d_units(bytes),
+        d_encoding(E_UTF8)
+    {}
+
+    //! Construct a view of the \a len code points at \a utf32_str.
+    StringView(const utf32* utf32_str, size_type len) :
+        d_data(utf32_str),
+        d_units(len),
+        d_encoding(E_UTF32)
+    {}
+
+    //! Return how the viewed code units encode code points.
+    Encoding getEncoding() const
+        { return d_encoding; }
+
+    //! Return the viewed code units.
+    const void* data() const
+        { return d_data; }
+
+    //! Return the number of viewed code units; bytes for E_CHAR and E_UTF8.
+    size_type getUnitCount() const
+        { return d_units; }
+
+    //! Return whether the view has no code points.
+    bool empty() const
+        { return d_units == 0; }
+
+    //! Return the number of code points; linear in the length for UTF-8.
+    size_type length() const;
+
+    /*!
+    \brief
+        Return the code point starting at the code unit \a unit, which must
+        be less than getUnitCount, and advance \a unit past it.
+
+        Malformed UTF-8 is decoded as String decodes it, except that a
+        sequence cut short by the end of the view ends there.
+    */
+    utf32 decode(size_type& unit) const
+    {
+        switch (d_encoding)
+        {
+        case E_UTF32:
+            return static_cast<const utf32*>(d_data)[unit++];
+
+        case E_CHAR:
+            return static_cast<const unsigned char*>(d_data)[unit++];
+
+        default:
+            return decodeUTF8(unit);
+        }
+    }
+
+    //! Return a String holding a copy of the viewed code points.
+    String str() const;
+
+private:
+    utf32 decodeUTF8(size_type& unit) const;
+
+    const void* d_data;
+    size_type d_units;
+    Encoding d_encoding;
+};
+
+//! Return whether \a lhs and \a rhs view the same code points.
+bool operator==(const StringView& lhs, const StringView& rhs);
+
+//! Return whether \a lhs and \a rhs view different code points.
+inline bool operator!=(const StringView& lhs, const StringView& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}
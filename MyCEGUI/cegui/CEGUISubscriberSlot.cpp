@@ -3,26 +3,63 @@
 namespace CEGUI
 {
 
-SubscriberSlot::SubscriberSlot(FreeFunctionSlot::SlotFunction* func) :
-d_functor_impl(new FreeFunctionSlot(func))
+SubscriberSlot::SubscriberSlot(FreeFunctionSlot::SlotFunction* func)
 {
+	d_functor_impl = new (allocate<FreeFunctionSlot>()) FreeFunctionSlot(func);
 }
 
 
 SubscriberSlot::SubscriberSlot() :
-d_functor_impl(0)
+d_functor_impl(0),
+d_inline(false)
 {
 }
 
 
+SubscriberSlot::SubscriberSlot(const SubscriberSlot& other)
+{
+	copyFunctor(other);
+}
+
+
+SubscriberSlot& SubscriberSlot::operator=(const SubscriberSlot& other)
+{
+	if (this != &other)
+	{
+		// a functor in our own storage is ours alone; a heap one is shared
+		// and left to whoever calls cleanup.
+		if (d_inline && d_functor_impl)
+			d_functor_impl->~SlotFunctorBase();
+
+		copyFunctor(other);
+	}
+
+	return *this;
+}
+
+
 SubscriberSlot::~SubscriberSlot()
 {
+	if (d_inline && d_functor_impl)
+		d_functor_impl->~SlotFunctorBase();
 }
 
 void SubscriberSlot::cleanup()
 {
-	delete d_functor_impl;
+	if (d_inline && d_functor_impl)
+		d_functor_impl->~SlotFunctorBase();
+	else
+		delete d_functor_impl;
+
 	d_functor_impl = 0;
+	d_inline = false;
 }
 
-}
\ No newline at end of file
+void SubscriberSlot::copyFunctor(const SubscriberSlot& other)
+{
+	d_inline = other.d_inline && other.d_functor_impl;
+	d_functor_impl = d_inline ?
+		other.d_functor_impl->copyTo(d_buffer.d_bytes) : other.d_functor_impl;
+}
+
+}
@@ -8,6 +8,8 @@
 #include "CEGUIMemberFunctionSlot.h"
 #include "CEGUIFunctorReferenceBinder.h"
 
+#include <new>
+
 namespace CEGUI
 {
 
@@ -19,6 +21,13 @@ public:
 
 	//ɺָʼ
     SubscriberSlot(FreeFunctionSlot::SlotFunction* func);
+    /*!
+    \brief
+        Copy constructor.  Functors held in the slot's own storage are copied;
+        heap allocated functors are shared with \a other, as before.
+    */
+    SubscriberSlot(const SubscriberSlot& other);
+    SubscriberSlot& operator=(const SubscriberSlot& other);
 	//virtualͣҪ
     ~SubscriberSlot();
     bool operator()(const EventArgs& args) const
@@ -34,28 +43,64 @@ public:
     void cleanup();
 	//ĳԱʼ
     template<typename T>
-    SubscriberSlot(bool (T::*function)(const EventArgs&), T* obj) :
-        d_functor_impl(new MemberFunctionSlot<T>(function, obj))
-    {}
+    SubscriberSlot(bool (T::*function)(const EventArgs&), T* obj)
+    {
+        d_functor_impl = new (allocate<MemberFunctionSlot<T> >())
+            MemberFunctionSlot<T>(function, obj);
+    }
 	//װĳãFunctorRefrenceBinderֻΪ˶Բ
     template<typename T>
-    SubscriberSlot(const FunctorReferenceBinder<T>& binder) :
-        d_functor_impl(new FunctorReferenceSlot<T>(binder.d_functor))
-    {}
+    SubscriberSlot(const FunctorReferenceBinder<T>& binder)
+    {
+        d_functor_impl = new (allocate<FunctorReferenceSlot<T> >())
+            FunctorReferenceSlot<T>(binder.d_functor);
+    }
 	//װĳĿ
     template<typename T>
     SubscriberSlot(const T& functor) :
-        d_functor_impl(new FunctorCopySlot<T>(functor))
+        d_functor_impl(new FunctorCopySlot<T>(functor)),
+        d_inline(false)
     {}
 	//Ժָķװ
     template<typename T>
-    SubscriberSlot(T* functor) :
-        d_functor_impl(new FunctorPointerSlot<T>(functor))
-    {}
+    SubscriberSlot(T* functor)
+    {
+        d_functor_impl = new (allocate<FunctorPointerSlot<T> >())
+            FunctorPointerSlot<T>(functor);
+    }
 
 private:
+    //! size of the storage for functors kept within the slot itself.
+    enum { BufferSize = 4 * sizeof(void*) };
+
+    /*!
+    \brief
+        Return storage for a functor of type Slot: the slot's own buffer if
+        it fits, so that free and member function subscribers - the common
+        case - need no heap allocation, else heap memory.
+    */
+    template<typename Slot>
+    void* allocate()
+    {
+        d_inline = sizeof(Slot) <= sizeof(d_buffer);
+        return d_inline ? static_cast<void*>(d_buffer.d_bytes) :
+                          ::operator new(sizeof(Slot));
+    }
+
+    //! copy the functor of \a other, see the copy constructor.
+    void copyFunctor(const SubscriberSlot& other);
+
     //ָָ
     SlotFunctorBase* d_functor_impl;
+    //! true if d_functor_impl is held in d_buffer.
+    bool d_inline;
+    //! storage for small functors, aligned for the pointers they hold.
+    union
+    {
+        char d_bytes[BufferSize];
+        void* d_pointer;
+        double d_double;
+    } d_buffer;
 };
 
 }
\ No newline at end of file
@@ -25,11 +25,14 @@
 #include "CEGUIRenderingRoot.h"
 #include "CEGUIRenderingWindow.h"
 #include "CEGUIRenderingContext.h"
+#include "CEGUIRenderQueue.h"
+#include "CEGUIClock.h"
 #include "CEGUIDefaultResourceProvider.h"
 #include "CEGUIImageCodec.h"
 #include "elements/CEGUIAll.h"
 #include <ctime>
 #include <clocale>
+#include <cmath>
 
 // declare create / destroy functions used for XMLParser and ImageCodec
 // modules as extern when static linking
@@ -66,10 +69,9 @@ public:
     double elapsed() { return currentTime() - d_baseTime; }
 };
 
-#include <windows.h>
 double SimpleTimer::currentTime()
 {
-    return timeGetTime() / 1000.0;
+    return Clock::getSeconds();
 }
 
 
@@ -122,6 +124,9 @@ String System::d_defaultXMLParserName(STRINGIZE(CEGUI_DEFAULT_XMLPARSER));
 // Holds name of default ImageCodec
 String System::d_defaultImageCodecName(STRINGIZE(CEGUI_DEFAULT_IMAGE_CODEC));
 
+// most separate dirty areas tracked before they are merged into one.
+static const size_t s_maxDirtyRects = 8;
+
 
 /*************************************************************************
     Constructor
@@ -165,7 +170,11 @@ System::System(Renderer& renderer,
   d_imageCodecModule(0),
   d_ourLogger(Logger::getSingletonPtr() == 0),
   d_customRenderedStringParser(0),
-  d_generateMouseClickEvents(true)
+  d_generateMouseClickEvents(true),
+  d_frameCount(0),
+  d_partialRedraw(false),
+  d_fullRedraw(true),
+  d_scheduledTimePulses(false)
 {
     // Start out by fixing the numeric locale to C (we depend on this behaviour)
     // consider a UVector2 as a property {{0.5,0},{0.5,0}} could become {{0,5,0},{0,5,0}}
@@ -338,11 +347,139 @@ System::~System(void)
 }
 
 
+//----------------------------------------------------------------------------//
+void System::signalRedraw(const Rect& area)
+{
+    d_gui_redraw = true;
+    invalidateScreenArea(area);
+}
+
+//----------------------------------------------------------------------------//
+void System::invalidateScreenArea(const Rect& area)
+{
+    // nothing to track if the whole display is going to be drawn anyway.
+    if (!d_partialRedraw || d_fullRedraw)
+        return;
+
+    // expand to whole pixels and limit to the display.
+    Rect r(std::floor(area.d_left), std::floor(area.d_top),
+           std::ceil(area.d_right), std::ceil(area.d_bottom));
+    r = r.getIntersection(Rect(Vector2(0, 0), d_renderer->getDisplaySize()));
+
+    if (r.getWidth() <= 0 || r.getHeight() <= 0)
+        return;
+
+    // the areas must not overlap, or the overlap would be drawn (and blended)
+    // more than once; so merge any area that overlaps the new one into it.
+    for (size_t i = 0; i < d_dirtyRects.size(); )
+    {
+        const Rect& d = d_dirtyRects[i];
+
+        if (d.d_left < r.d_right && r.d_left < d.d_right &&
+            d.d_top < r.d_bottom && r.d_top < d.d_bottom)
+        {
+            r.d_left   = ceguimin(r.d_left, d.d_left);
+            r.d_top    = ceguimin(r.d_top, d.d_top);
+            r.d_right  = ceguimax(r.d_right, d.d_right);
+            r.d_bottom = ceguimax(r.d_bottom, d.d_bottom);
+
+            // the larger area may now overlap ones checked already.
+            d_dirtyRects.erase(d_dirtyRects.begin() + i);
+            i = 0;
+        }
+        else
+            ++i;
+    }
+
+    d_dirtyRects.push_back(r);
+
+    // past a handful of areas a single area covering them all is cheaper.
+    if (d_dirtyRects.size() > s_maxDirtyRects)
+    {
+        for (size_t i = 0; i < d_dirtyRects.size(); ++i)
+        {
+            const Rect& d = d_dirtyRects[i];
+            r.d_left   = ceguimin(r.d_left, d.d_left);
+            r.d_top    = ceguimin(r.d_top, d.d_top);
+            r.d_right  = ceguimax(r.d_right, d.d_right);
+            r.d_bottom = ceguimax(r.d_bottom, d.d_bottom);
+        }
+
+        d_dirtyRects.assign(1, r);
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool System::isInRedrawRegion(const Rect& area) const
+{
+    if (d_redrawRects.empty())
+        return true;
+
+    for (size_t i = 0; i < d_redrawRects.size(); ++i)
+    {
+        const Rect& r = d_redrawRects[i];
+
+        if (r.d_left < area.d_right && area.d_left < r.d_right &&
+            r.d_top < area.d_bottom && area.d_top < r.d_bottom)
+            return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void System::setPartialRedrawEnabled(bool setting)
+{
+    if (setting == d_partialRedraw)
+        return;
+
+    d_partialRedraw = setting;
+    // nothing is known about what is on the display yet, so draw it all.
+    signalRedraw();
+}
+
 /*************************************************************************
 	Render the GUI for this frame
 *************************************************************************/
 void System::renderGUI(void)
 {
+    // deliver the events deferred since the last frame before drawing it.
+    d_eventQueue.drain();
+
+    RenderQueue::resetFrameCounters();
+    d_renderProfiler.beginFrame();
+
+    // with partial redraw, only the changed areas of the display are drawn
+    // and the renderer keeps the rest from the previous frame.  A renderer
+    // that can not keep display content simply draws it all.
+    if (d_partialRedraw && !d_fullRedraw &&
+        d_renderer->supportsRedrawRegion())
+    {
+        // nothing changed, so there is nothing to draw.
+        if (d_dirtyRects.empty())
+        {
+            d_frameStats.reset();
+            ++d_frameCount;
+            d_renderProfiler.endFrame();
+            if (d_eventTracer.isEnabled())
+                d_eventTracer.endFrame();
+            WindowManager::getSingleton().cleanDeadPool();
+            return;
+        }
+
+        // the render queues are rebuilt from only the windows in the areas
+        // being drawn.
+        d_redrawRects.swap(d_dirtyRects);
+        d_gui_redraw = true;
+
+        d_renderer->setRedrawRegion(&d_redrawRects[0],
+                                    static_cast<uint>(d_redrawRects.size()));
+    }
+
+    // everything that was waiting to be redrawn is drawn now.
+    d_dirtyRects.clear();
+    d_fullRedraw = false;
+
     d_renderer->beginRendering();
 
 	if (d_gui_redraw)
@@ -368,6 +505,18 @@ void System::renderGUI(void)
 	MouseCursor::getSingleton().draw();
     d_renderer->endRendering();
 
+    d_redrawRects.clear();
+
+    // keep a copy of the renderer's counters for this frame
+    if (const RenderStatistics* stats = d_renderer->getRenderStatistics())
+        d_frameStats = *stats;
+    d_frameStats.d_geometryBuffersQueued = RenderQueue::getFrameBuffersQueued();
+    d_frameStats.d_geometryBuffersMerged = RenderQueue::getFrameBuffersMerged();
+    ++d_frameCount;
+    d_renderProfiler.endFrame();
+    if (d_eventTracer.isEnabled())
+        d_eventTracer.endFrame();
+
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
 }
@@ -389,6 +538,9 @@ Window* System::setGUISheet(Window* sheet)
         sheet->onParentSized(sheetargs);
     }
 
+    // windows that were outside of the previous sheet may now be updated.
+    d_timePulseScheduler.resumeParked();
+
 	// fire event
 	WindowEventArgs args(old);
 	onGUISheetChanged(args);
@@ -941,8 +1093,21 @@ bool System::injectMousePosition(float x_pos, float y_pos)
 *************************************************************************/
 bool System::injectTimePulse(float timeElapsed)
 {
+    // fire the events other threads posted since the last time pulse.
+    d_postedEventQueue.drain();
+
     AnimationManager::getSingleton().stepInstances(timeElapsed);
 
+    // only windows with due updates are visited; time still passes for them
+    // while there is no visible sheet.
+    if (d_scheduledTimePulses)
+    {
+        const bool sheet_visible = d_activeSheet && d_activeSheet->isVisible();
+        d_timePulseScheduler.pulse(timeElapsed,
+                                   sheet_visible ? d_activeSheet : 0);
+        return sheet_visible;
+    }
+
     // if no visible active sheet, input can't be handled
     if (!d_activeSheet || !d_activeSheet->isVisible())
         return false;
@@ -954,6 +1119,34 @@ bool System::injectTimePulse(float timeElapsed)
 }
 
 
+//----------------------------------------------------------------------------//
+void System::setScheduledTimePulsesEnabled(bool setting)
+{
+    if (setting == d_scheduledTimePulses)
+        return;
+
+    d_scheduledTimePulses = setting;
+    d_timePulseScheduler.clear();
+
+    if (!d_scheduledTimePulses)
+        return;
+
+    // windows that are already in a time dependent state need an update
+    // scheduled, since they did not request one while this was disabled.
+    WindowManager::WindowIterator iter =
+        WindowManager::getSingleton().getIterator();
+
+    for (; !iter.isAtEnd(); ++iter)
+    {
+        Window* const wnd = iter.getCurrentValue();
+
+        if (wnd->needsContinuousUpdate() ||
+            (wnd->d_autoRepeat && wnd->d_repeatButton != NoButton))
+            d_timePulseScheduler.schedule(*wnd, 0);
+    }
+}
+
+
 /*************************************************************************
 	Return window that should get mouse inouts when mouse it at 'pt'
 *************************************************************************/
@@ -4,9 +4,18 @@
 #include "CEGUIString.h"
 #include "CEGUISingleton.h"
 #include "CEGUIRenderer.h"
+#include "CEGUIEventQueue.h"
+#include "CEGUIEventTracer.h"
+#include "CEGUIPostedEventQueue.h"
+#include "CEGUIRenderProfiler.h"
+#include "CEGUIRenderStatistics.h"
+#include "CEGUITimePulseScheduler.h"
 #include "CEGUIMouseCursor.h"
 #include "CEGUIInputEvent.h"
 #include "CEGUIResourceProvider.h"
+#include "CEGUIRect.h"
+
+#include <vector>
 
 namespace CEGUI
 {
@@ -66,10 +75,142 @@ public:
 	void	setDefaultFont(Font* font);
 	Font*	getDefaultFont(void) const				{return d_defaultFont;}
 	//´renderGUI()ʱػ
-	void	signalRedraw()		{d_gui_redraw = true;}
+	void	signalRedraw()		{d_gui_redraw = true; d_fullRedraw = true;}
 	//һrenderGUI()ǷҪȫػ
 	bool	isRedrawRequested() const		{return d_gui_redraw;}
 	void	renderGUI(void);
+
+    /*!
+    \brief
+        Return the RenderStatistics captured at the end of the most recent
+        call to renderGUI.  All counters are zero when the Renderer in use does
+        not collect statistics.
+    */
+    const RenderStatistics& getFrameStatistics() const  {return d_frameStats;}
+
+    //! Return the number of frames rendered via renderGUI so far.
+    uint getFrameCount() const  {return d_frameCount;}
+
+    /*!
+    \brief
+        Return the RenderProfiler that records per-window timings of the
+        frames drawn by renderGUI.  Profiling is disabled by default; enable
+        it with RenderProfiler::setEnabled.
+    */
+    RenderProfiler& getRenderProfiler()  {return d_renderProfiler;}
+
+    //! \copydoc getRenderProfiler
+    const RenderProfiler& getRenderProfiler() const  {return d_renderProfiler;}
+
+    /*!
+    \brief
+        Return the EventTracer that gathers per-event dispatch statistics.
+        Tracing is disabled by default; enable it with
+        EventTracer::setEnabled.
+    */
+    EventTracer& getEventTracer()  {return d_eventTracer;}
+
+    //! \copydoc getEventTracer
+    const EventTracer& getEventTracer() const  {return d_eventTracer;}
+
+    /*!
+    \brief
+        Enable or disable scheduled time pulses.
+
+        By default injectTimePulse updates every window of the active GUI
+        sheet.  With scheduled time pulses, it instead updates only windows
+        that requested an update via Window::scheduleUpdate, or that report
+        Window::needsContinuousUpdate, so an idle GUI costs close to nothing
+        per time pulse.
+
+    \note
+        Window classes and WindowRenderers with time dependent behaviour of
+        their own must request updates via Window::scheduleUpdate for this to
+        work; windows are only updated via Window::updateSelf, and overrides
+        of Window::update are not called.
+    */
+    void setScheduledTimePulsesEnabled(bool setting);
+
+    //! Return whether scheduled time pulses are enabled.
+    bool isScheduledTimePulsesEnabled() const  {return d_scheduledTimePulses;}
+
+    //! Return the TimePulseScheduler used for scheduled time pulses.
+    TimePulseScheduler& getTimePulseScheduler()  {return d_timePulseScheduler;}
+
+    /*!
+    \brief
+        Return the EventQueue holding deferred window events.  Events are
+        only deferred once marked via EventQueue::setDeferred; the queue is
+        drained at the start of each renderGUI.
+    */
+    EventQueue& getEventQueue()  {return d_eventQueue;}
+
+    /*!
+    \brief
+        Return the PostedEventQueue through which other threads post events
+        to windows.  Posted events are fired at the start of each
+        injectTimePulse.
+    */
+    PostedEventQueue& getPostedEventQueue()  {return d_postedEventQueue;}
+
+    /*!
+    \brief
+        Request that window content is re-rendered at the next call to
+        renderGUI, where the change is limited to the display area \a area.
+
+        Unlike signalRedraw, which may change anything on the display, this
+        only adds \a area to the region that is drawn again when partial
+        redraw is enabled.
+    */
+    void signalRedraw(const Rect& area);
+
+    /*!
+    \brief
+        Mark an area of the display as needing to be drawn again at the next
+        call to renderGUI, without re-rendering any window content; for
+        example where the mouse cursor has moved.  Has no effect unless
+        partial redraw is enabled.
+    */
+    void invalidateScreenArea(const Rect& area);
+
+    /*!
+    \brief
+        Set whether renderGUI only redraws the areas of the display that have
+        changed since the previous frame.
+
+        This requires a Renderer that keeps the content of the display
+        between frames (see Renderer::setRedrawRegion), and that the host
+        application does not clear the display itself; with any other
+        Renderer the whole display is still drawn every frame.  When nothing
+        at all has changed and the Renderer keeps display content (see
+        Renderer::supportsRedrawRegion), renderGUI does not draw anything.
+        Otherwise only the windows drawn straight to the display whose area
+        intersects the changed areas are queued for drawing.
+
+    \param setting
+        - true to only redraw areas that have changed.
+        - false to redraw the whole display every frame.
+    */
+    void setPartialRedrawEnabled(bool setting);
+
+    //! Return whether renderGUI only redraws areas that have changed.
+    bool isPartialRedrawEnabled() const  {return d_partialRedraw;}
+
+    /*!
+    \brief
+        Return the non-overlapping areas of the display that the next call to
+        renderGUI will redraw when partial redraw is enabled.  This is empty
+        if either nothing or the whole display needs to be redrawn.
+    */
+    const std::vector<Rect>& getDirtyRects() const  {return d_dirtyRects;}
+
+    /*!
+    \brief
+        Return whether any part of the display area \a area is drawn by the
+        renderGUI in progress.  This is always true outside of renderGUI, and
+        during a renderGUI that draws the whole display.
+    */
+    bool isInRedrawRegion(const Rect& area) const;
 	Window*	setGUISheet(Window* sheet);
 	Window*	getGUISheet(void) const		{return d_activeSheet;}
 	double	getSingleClickTimeout(void) const		{return d_click_timeout;}
@@ -465,6 +606,30 @@ private:
     RenderedStringParser* d_customRenderedStringParser;
     //! true if mouse click events will be automatically generated.
     bool d_generateMouseClickEvents;
+    //! renderer statistics for the last frame drawn by renderGUI.
+    RenderStatistics d_frameStats;
+    //! number of frames drawn by renderGUI.
+    uint d_frameCount;
+    //! profiler for the frames drawn by renderGUI.
+    RenderProfiler d_renderProfiler;
+    //! event dispatch statistics, by frame drawn by renderGUI.
+    EventTracer d_eventTracer;
+    //! true if only changed areas of the display are redrawn.
+    bool d_partialRedraw;
+    //! true if the whole display has to be redrawn at the next renderGUI.
+    bool d_fullRedraw;
+    //! non-overlapping areas of the display to redraw at the next renderGUI.
+    std::vector<Rect> d_dirtyRects;
+    //! areas being redrawn by the renderGUI in progress; empty if all is.
+    std::vector<Rect> d_redrawRects;
+    //! true if time pulses only update windows with scheduled updates.
+    bool d_scheduledTimePulses;
+    //! deadlines of windows that requested an update.
+    TimePulseScheduler d_timePulseScheduler;
+    //! deferred window events waiting for the next renderGUI.
+    EventQueue d_eventQueue;
+    //! events posted by other threads, waiting for the next time pulse.
+    PostedEventQueue d_postedEventQueue;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include "CEGUITimePulseScheduler.h"
+#include "CEGUIWindow.h"
+
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+TimePulseScheduler::TimePulseScheduler() :
+    d_time(0),
+    d_parkedCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+void TimePulseScheduler::schedule(Window& window, float delay)
+{
+    EntryMap::iterator e = d_entries.find(&window);
+
+    if (e == d_entries.end())
+    {
+        Entry entry;
+        entry.d_queued = false;
+        entry.d_parked = false;
+        entry.d_lastUpdate = d_time;
+        e = d_entries.insert(std::make_pair(&window, entry)).first;
+    }
+
+    enqueue(e, window, d_time + ceguimax(delay, 0.0f));
+}
+
+//----------------------------------------------------------------------------//
+void TimePulseScheduler::cancel(const Window& window)
+{
+    EntryMap::iterator e = d_entries.find(&window);
+    if (e == d_entries.end())
+        return;
+
+    if (e->second.d_queued)
+        d_queue.erase(e->second.d_position);
+
+    if (e->second.d_parked)
+        --d_parkedCount;
+
+    d_entries.erase(e);
+
+    // the window may be cancelled - or destroyed - while a pulse is in
+    // progress, in which case it must not be updated by that pulse.
+    std::replace(d_due.begin(), d_due.end(), const_cast<Window*>(&window),
+                 static_cast<Window*>(0));
+}
+
+//----------------------------------------------------------------------------//
+bool TimePulseScheduler::isScheduled(const Window& window) const
+{
+    EntryMap::const_iterator e = d_entries.find(&window);
+    return e != d_entries.end() && (e->second.d_queued || e->second.d_parked);
+}
+
+//----------------------------------------------------------------------------//
+size_t TimePulseScheduler::getScheduledCount() const
+{
+    return d_queue.size() + d_parkedCount;
+}
+
+//----------------------------------------------------------------------------//
+void TimePulseScheduler::resumeParked(const Window* root)
+{
+    if (!d_parkedCount)
+        return;
+
+    for (EntryMap::iterator e = d_entries.begin(); e != d_entries.end(); ++e)
+    {
+        if (!e->second.d_parked)
+            continue;
+
+        Window* const wnd = const_cast<Window*>(e->first);
+        if (root && wnd != root && !wnd->isAncestor(root))
+            continue;
+
+        // time passed while parked is not delivered.
+        e->second.d_lastUpdate = d_time;
+        enqueue(e, *wnd, d_time);
+    }
+}
+
+//----------------------------------------------------------------------------//
+double TimePulseScheduler::getTime() const
+{
+    return d_time;
+}
+
+//----------------------------------------------------------------------------//
+uint TimePulseScheduler::pulse(float elapsed, Window* root)
+{
+    d_time += elapsed;
+
+    // collect the due windows first, since updating them may schedule more.
+    d_due.clear();
+    while (!d_queue.empty() && d_queue.begin()->first <= d_time)
+    {
+        Window* const wnd = d_queue.begin()->second;
+        d_entries[wnd].d_queued = false;
+        d_queue.erase(d_queue.begin());
+        d_due.push_back(wnd);
+    }
+
+    uint updated = 0;
+    for (size_t i = 0; i < d_due.size(); ++i)
+    {
+        Window* const wnd = d_due[i];
+        if (!wnd)
+            continue;
+
+        EntryMap::iterator e = d_entries.find(wnd);
+        const float since = static_cast<float>(d_time - e->second.d_lastUpdate);
+        e->second.d_lastUpdate = d_time;
+
+        // windows not reached by a recursive update are parked until
+        // resumeParked is called for them.
+        if (!root || !isUpdated(*wnd, *root))
+        {
+            e->second.d_parked = true;
+            ++d_parkedCount;
+            continue;
+        }
+
+        wnd->update_impl(since);
+        ++updated;
+
+        // the window may have been cancelled by its own update.
+        if (!d_due[i])
+            continue;
+
+        e = d_entries.find(wnd);
+        if (e->second.d_queued)
+            continue;
+
+        if (wnd->needsContinuousUpdate())
+            enqueue(e, *wnd, d_time);
+        else
+            d_entries.erase(e);
+    }
+
+    d_due.clear();
+
+    return updated;
+}
+
+//----------------------------------------------------------------------------//
+void TimePulseScheduler::clear()
+{
+    d_queue.clear();
+    d_entries.clear();
+    d_parkedCount = 0;
+    std::fill(d_due.begin(), d_due.end(), static_cast<Window*>(0));
+}
+
+//----------------------------------------------------------------------------//
+void TimePulseScheduler::enqueue(EntryMap::iterator e, Window& window,
+                                 double time)
+{
+    if (e->second.d_queued)
+        d_queue.erase(e->second.d_position);
+
+    if (e->second.d_parked)
+    {
+        e->second.d_parked = false;
+        --d_parkedCount;
+    }
+
+    e->second.d_position = d_queue.insert(std::make_pair(time, &window));
+    e->second.d_queued = true;
+}
+
+//----------------------------------------------------------------------------//
+bool TimePulseScheduler::isUpdated(const Window& window, const Window& root)
+{
+    for (const Window* wnd = &window; wnd; wnd = wnd->getParent())
+    {
+        // the sheet itself is updated whenever it is visible.
+        if (wnd == &root)
+            return root.isVisible(true);
+
+        const WindowUpdateMode mode = wnd->getUpdateMode();
+        if (mode == WUM_NEVER || (mode == WUM_VISIBLE && !wnd->isVisible(true)))
+            return false;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
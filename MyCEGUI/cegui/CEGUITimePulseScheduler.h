@@ -0,0 +1,131 @@
+#pragma once
+
+#include "CEGUIBase.h"
+
+#include <map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Delivers time pulses only to windows that have time dependent work.
+
+    Windows register a deadline with Window::scheduleUpdate - for example when
+    mouse auto-repeat starts, or a tooltip begins to count its hover time -
+    and a time pulse then updates only the windows whose deadline has passed,
+    instead of walking every window in the GUI.  Deadlines are one-shot; a
+    window that wants further updates schedules again from its update, while
+    windows that need an update on every pulse say so via
+    Window::needsContinuousUpdate.
+
+    Each window is passed the time elapsed since its previous update, or since
+    its deadline was first scheduled.  As with the recursive update, windows
+    are only updated while they are within the active GUI sheet and their
+    WindowUpdateMode allows it; time passing while that is not the case is not
+    delivered.  A due window that can not be updated is parked rather than
+    checked again on every pulse, until resumeParked is called for it - which
+    the Window and System do when a window is shown, attached, or has its
+    update mode changed, and when the GUI sheet changes.
+
+    The System owns the scheduler and uses it when scheduled time pulses are
+    enabled, see System::setScheduledTimePulsesEnabled.
+*/
+class TimePulseScheduler
+{
+public:
+    //! Constructor.
+    TimePulseScheduler();
+
+    /*!
+    \brief
+        Schedule \a window to be updated once \a delay seconds of time pulses
+        have passed, replacing any deadline it already has.  A delay of 0
+        updates the window at the next time pulse.
+    */
+    void schedule(Window& window, float delay);
+
+    //! Remove any deadline of \a window.
+    void cancel(const Window& window);
+
+    //! Return whether \a window has a deadline, or is parked.
+    bool isScheduled(const Window& window) const;
+
+    //! Return the number of windows that have a deadline, or are parked.
+    size_t getScheduledCount() const;
+
+    /*!
+    \brief
+        Give the parked windows within \a root - or all parked windows, if
+        \a root is 0 - a deadline at the next time pulse, since they may be
+        updated again.
+    */
+    void resumeParked(const Window* root = 0);
+
+    //! Return the total time passed in time pulses, in seconds.
+    double getTime() const;
+
+    /*!
+    \brief
+        Advance time by \a elapsed seconds and update the windows whose
+        deadline has passed.
+
+    \param elapsed
+        Time in seconds since the previous time pulse.
+
+    \param root
+        The active GUI sheet.  Only windows within it are updated.
+
+    \return
+        Number of windows updated.
+    */
+    uint pulse(float elapsed, Window* root);
+
+    //! Remove all deadlines.
+    void clear();
+
+private:
+    //! deadlines in time order.
+    typedef std::multimap<double, Window*> Queue;
+
+    struct Entry
+    {
+        //! position of the window's deadline in d_queue, if d_queued.
+        Queue::iterator d_position;
+        //! true if the window has a deadline.
+        bool d_queued;
+        //! true if the window was due but could not be updated.
+        bool d_parked;
+        //! time of the window's previous update.
+        double d_lastUpdate;
+    };
+
+    typedef std::map<const Window*, Entry> EntryMap;
+
+    //! set the deadline of the window for entry \a e to \a time.
+    void enqueue(EntryMap::iterator e, Window& window, double time);
+
+    //! return whether the recursive update from \a root would reach \a window.
+    static bool isUpdated(const Window& window, const Window& root);
+
+    //! total time passed in time pulses.
+    double d_time;
+    Queue d_queue;
+    //! number of entries that are parked.
+    size_t d_parkedCount;
+    //! state of every window that is queued or being updated.
+    EntryMap d_entries;
+    //! windows being updated by the current pulse; reused between pulses.
+    std::vector<Window*> d_due;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
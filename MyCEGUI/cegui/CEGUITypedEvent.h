@@ -0,0 +1,379 @@
+#pragma once
+
+#include "CEGUIBase.h"
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+namespace CEGUI
+{
+/*!
+\brief
+    Event whose handlers take the concrete EventArgs type \a Args, for the
+    hottest input events.
+
+    Unlike Event, which calls every handler through the virtual
+    SlotFunctorBase and leaves it to the handler to downcast the
+    EventArgs, a TypedEvent stores each handler as a plain function pointer
+    to an invoker generated for the handler's type, next to the handler's
+    object or functor in a small buffer.  Member functions are given as
+    template arguments, so the invoker calls them directly and the compiler
+    can inline them:
+
+    \code
+    wnd->getMouseMoveEvent().subscribe<Game, &Game::onMouseMove>(game);
+    \endcode
+
+    Functors - and free functions - are copied into the buffer, or onto the
+    heap when larger than it, and their operator() is likewise called
+    directly by the invoker.
+
+    Handlers are called in group order, and in subscription order within a
+    group, as with Event.  Subscribing and unsubscribing while the event is
+    dispatched is allowed; new handlers are called from the next dispatch.
+
+    TypedEvents coexist with the String based events: a Window fires the
+    TypedEvent for an input as well as the named event, so existing
+    subscriptions are unaffected.  Handlers are not traced by the
+    EventTracer.
+*/
+template<typename Args>
+class TypedEvent
+{
+public:
+    typedef unsigned int Group;
+    //! Identifies a subscription, for unsubscribe.  0 is never returned.
+    typedef uint Connection;
+    //! Free function handler type.
+    typedef bool (*FunctionType)(const Args&);
+
+    TypedEvent() :
+        d_nextID(1),
+        d_removedCount(0),
+        d_dispatchDepth(0)
+    {}
+
+    /*!
+    \brief
+        Subscribe the member function \a Function of \a obj, in \a group.
+        The call is bound at compile time.
+    */
+    template<typename T, bool (T::*Function)(const Args&)>
+    Connection subscribe(T* obj, Group group = static_cast<Group>(-1))
+    {
+        Handler handler(group, d_nextID++);
+        handler.d_invoke = &invokeMember<T, Function>;
+        handler.d_buffer.d_pointer = obj;
+
+        return add(handler);
+    }
+
+    //! Subscribe the free function \a function, in \a group.
+    Connection subscribe(FunctionType function,
+                         Group group = static_cast<Group>(-1))
+    {
+        return subscribe<FunctionType>(function, group);
+    }
+
+    //! Subscribe a copy of \a functor, in \a group.
+    template<typename Functor>
+    Connection subscribe(const Functor& functor,
+                         Group group = static_cast<Group>(-1))
+    {
+        Handler handler(group, d_nextID++);
+
+        store(handler, functor, Fits<(sizeof(Functor) <= BufferSize)>());
+
+        return add(handler);
+    }
+
+    //! Remove the subscription \a connection, if it still exists.
+    void unsubscribe(Connection connection)
+    {
+        typename HandlerList::iterator i =
+            std::find_if(d_handlers.begin(), d_handlers.end(),
+                         HasID(connection));
+
+        if (i != d_handlers.end())
+        {
+            // during dispatch the handler is only cleared, and erased after.
+            if (d_dispatchDepth)
+            {
+                if (i->d_invoke)
+                {
+                    i->d_invoke = 0;
+                    ++d_removedCount;
+                }
+            }
+            else
+                d_handlers.erase(i);
+
+            return;
+        }
+
+        i = std::find_if(d_pending.begin(), d_pending.end(),
+                         HasID(connection));
+
+        if (i != d_pending.end())
+            d_pending.erase(i);
+    }
+
+    //! Return the number of subscriptions.
+    size_t getConnectionCount() const
+        { return d_handlers.size() + d_pending.size() - d_removedCount; }
+
+    //! Call all handlers, incrementing args.handled for each returning true.
+    void operator()(Args& args)
+    {
+        if (d_handlers.empty())
+            return;
+
+        DispatchGuard guard(*this);
+
+        // d_handlers is not resized while dispatching.
+        const size_t count = d_handlers.size();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            Handler& handler = d_handlers[i];
+
+            if (handler.d_invoke && handler.d_invoke(handler, args))
+                ++args.handled;
+        }
+    }
+
+private:
+    //! size of the storage for handlers kept within the Handler itself.
+    enum { BufferSize = 4 * sizeof(void*) };
+
+    //! A subscription.
+    struct Handler
+    {
+        //! calls the handler.
+        typedef bool (*InvokeFunction)(Handler&, const Args&);
+        //! copies the functor of \a src to \a dst, or destroys that of
+        //! \a dst if \a src is 0.
+        typedef void (*ManageFunction)(Handler& dst, const Handler* src);
+
+        Handler(Group group, Connection id) :
+            d_invoke(0),
+            d_manage(0),
+            d_group(group),
+            d_id(id)
+        {}
+
+        Handler(const Handler& other) :
+            d_invoke(other.d_invoke),
+            d_manage(other.d_manage),
+            d_group(other.d_group),
+            d_id(other.d_id)
+        {
+            copyBuffer(other);
+        }
+
+        Handler& operator=(const Handler& other)
+        {
+            if (this != &other)
+            {
+                if (d_manage)
+                    d_manage(*this, 0);
+
+                d_invoke = other.d_invoke;
+                d_manage = other.d_manage;
+                d_group = other.d_group;
+                d_id = other.d_id;
+                copyBuffer(other);
+            }
+
+            return *this;
+        }
+
+        ~Handler()
+        {
+            if (d_manage)
+                d_manage(*this, 0);
+        }
+
+        void copyBuffer(const Handler& other)
+        {
+            if (d_manage)
+                d_manage(*this, &other);
+            else
+                d_buffer = other.d_buffer;
+        }
+
+        //! 0 once unsubscribed during dispatch.
+        InvokeFunction d_invoke;
+        //! 0 if the buffer may be copied bitwise.
+        ManageFunction d_manage;
+        Group d_group;
+        Connection d_id;
+        //! the object, functor or heap allocated functor.
+        union
+        {
+            char d_bytes[BufferSize];
+            void* d_pointer;
+            double d_double;
+        } d_buffer;
+    };
+
+    typedef std::vector<Handler> HandlerList;
+
+    //! matches the Handler of a Connection.
+    struct HasID
+    {
+        HasID(Connection id) : d_id(id) {}
+        bool operator()(const Handler& handler) const
+            { return handler.d_id == d_id; }
+        Connection d_id;
+    };
+
+    //! orders Handlers by group.
+    struct GroupLess
+    {
+        bool operator()(Group group, const Handler& handler) const
+            { return group < handler.d_group; }
+    };
+
+    //! Tracks dispatch depth, applying deferred changes on leaving the last.
+    class DispatchGuard
+    {
+    public:
+        DispatchGuard(TypedEvent& event) :
+            d_event(event)
+        {
+            ++d_event.d_dispatchDepth;
+        }
+
+        ~DispatchGuard()
+        {
+            if (!--d_event.d_dispatchDepth)
+                d_event.applyDeferredChanges();
+        }
+
+    private:
+        void operator=(const DispatchGuard&) {}
+        TypedEvent& d_event;
+    };
+    friend class DispatchGuard;
+
+    //! selects how store keeps a functor.
+    template<bool> struct Fits {};
+
+    //! keep \a functor in the buffer of \a handler.
+    template<typename Functor>
+    static void store(Handler& handler, const Functor& functor, Fits<true>)
+    {
+        new (handler.d_buffer.d_bytes) Functor(functor);
+        handler.d_invoke = &invokeInline<Functor>;
+        handler.d_manage = &manageInline<Functor>;
+    }
+
+    //! keep \a functor on the heap, as it does not fit the buffer.
+    template<typename Functor>
+    static void store(Handler& handler, const Functor& functor, Fits<false>)
+    {
+        handler.d_buffer.d_pointer = new Functor(functor);
+        handler.d_invoke = &invokeHeap<Functor>;
+        handler.d_manage = &manageHeap<Functor>;
+    }
+
+    template<typename T, bool (T::*Function)(const Args&)>
+    static bool invokeMember(Handler& handler, const Args& args)
+    {
+        return (static_cast<T*>(handler.d_buffer.d_pointer)->*Function)(args);
+    }
+
+    template<typename Functor>
+    static bool invokeInline(Handler& handler, const Args& args)
+    {
+        return (*reinterpret_cast<Functor*>(handler.d_buffer.d_bytes))(args);
+    }
+
+    template<typename Functor>
+    static bool invokeHeap(Handler& handler, const Args& args)
+    {
+        return (*static_cast<Functor*>(handler.d_buffer.d_pointer))(args);
+    }
+
+    template<typename Functor>
+    static void manageInline(Handler& dst, const Handler* src)
+    {
+        if (src)
+            new (dst.d_buffer.d_bytes) Functor(
+                *reinterpret_cast<const Functor*>(src->d_buffer.d_bytes));
+        else
+            reinterpret_cast<Functor*>(dst.d_buffer.d_bytes)->~Functor();
+    }
+
+    template<typename Functor>
+    static void manageHeap(Handler& dst, const Handler* src)
+    {
+        if (src)
+            dst.d_buffer.d_pointer = new Functor(
+                *static_cast<const Functor*>(src->d_buffer.d_pointer));
+        else
+            delete static_cast<Functor*>(dst.d_buffer.d_pointer);
+    }
+
+    //! add \a handler, now or - during dispatch - after it.
+    Connection add(const Handler& handler)
+    {
+        if (d_dispatchDepth)
+            d_pending.push_back(handler);
+        else
+            insert(handler);
+
+        return handler.d_id;
+    }
+
+    //! add \a handler after all handlers of the same or a lower group.
+    void insert(const Handler& handler)
+    {
+        d_handlers.insert(std::upper_bound(d_handlers.begin(),
+                                           d_handlers.end(),
+                                           handler.d_group, GroupLess()),
+                          handler);
+    }
+
+    //! apply the changes deferred while the event was being dispatched.
+    void applyDeferredChanges()
+    {
+        if (d_removedCount)
+        {
+            typename HandlerList::iterator out = d_handlers.begin();
+            for (typename HandlerList::iterator in = d_handlers.begin();
+                 in != d_handlers.end(); ++in)
+            {
+                if (in->d_invoke)
+                    *out++ = *in;
+            }
+
+            d_handlers.erase(out, d_handlers.end());
+            d_removedCount = 0;
+        }
+
+        for (size_t i = 0; i < d_pending.size(); ++i)
+            insert(d_pending[i]);
+
+        d_pending.clear();
+    }
+
+    // Copying would duplicate the subscriptions, but not their Connections.
+    TypedEvent(const TypedEvent&);
+    TypedEvent& operator=(const TypedEvent&);
+
+    //! Handlers sorted by group, see Event::d_slots.
+    HandlerList d_handlers;
+    //! subscriptions made during dispatch.
+    HandlerList d_pending;
+    //! id of the next subscription.
+    Connection d_nextID;
+    //! handlers cleared in d_handlers during dispatch.
+    size_t d_removedCount;
+    //! number of dispatches in progress.
+    uint d_dispatchDepth;
+};
+
+}
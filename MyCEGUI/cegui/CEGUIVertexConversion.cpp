@@ -0,0 +1,223 @@
+#include "CEGUIVertexConversion.h"
+#include "CEGUIVertex.h"
+
+#if defined(CEGUI_SIMD_SSE2)
+#   include <emmintrin.h>
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// copy everything but the colour from \a s to \a d.
+static inline void copyPositionAndUV(const Vertex& s, PackedVertex& d,
+                                     float xy_offset)
+{
+    d.x  = s.position.d_x + xy_offset;
+    d.y  = s.position.d_y + xy_offset;
+    d.z  = s.position.d_z;
+    d.tu = s.tex_coords.d_x;
+    d.tv = s.tex_coords.d_y;
+}
+
+//----------------------------------------------------------------------------//
+void VertexConversion::convert(const Vertex* src, PackedVertex* dst,
+                               uint count, float xy_offset)
+{
+#if defined(CEGUI_SIMD_SSE2)
+    convertSSE2(src, dst, count, xy_offset);
+#else
+    convertScalar(src, dst, count, xy_offset);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void VertexConversion::convertScalar(const Vertex* src, PackedVertex* dst,
+                                     uint count, float xy_offset)
+{
+    for (uint i = 0; i < count; ++i, ++src, ++dst)
+    {
+        copyPositionAndUV(*src, *dst, xy_offset);
+
+        // same calculation as colour::getARGB, without touching the cache
+        // that it keeps in the source vertex.
+        const colour& c = src->colour_val;
+        dst->diffuse = static_cast<argb_t>(c.d_alpha * 255) << 24 |
+                       static_cast<argb_t>(c.d_red * 255) << 16 |
+                       static_cast<argb_t>(c.d_green * 255) << 8 |
+                       static_cast<argb_t>(c.d_blue * 255);
+    }
+}
+
+#if defined(CEGUI_SIMD_SSE2)
+//----------------------------------------------------------------------------//
+// return the integer colour components at \a argb (alpha, red, green, blue)
+// scaled to [0, 255] and ordered b, g, r, a; so that packing them to bytes
+// yields a little endian ARGB value.
+static inline __m128i scaledColourSSE2(const float* argb, const __m128 scale)
+{
+    __m128 v = _mm_loadu_ps(argb);
+    v = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3));
+    return _mm_cvttps_epi32(_mm_mul_ps(v, scale));
+}
+
+//----------------------------------------------------------------------------//
+void VertexConversion::convertSSE2(const Vertex* src, PackedVertex* dst,
+                                   uint count, float xy_offset)
+{
+    const __m128 scale = _mm_set1_ps(255.0f);
+    argb_t argb[4];
+
+    uint i = 0;
+    for ( ; i + 4 <= count; i += 4, src += 4, dst += 4)
+    {
+        // pack the colours of four vertices at once.
+        const __m128i c01 = _mm_packs_epi32(
+            scaledColourSSE2(&src[0].colour_val.d_alpha, scale),
+            scaledColourSSE2(&src[1].colour_val.d_alpha, scale));
+        const __m128i c23 = _mm_packs_epi32(
+            scaledColourSSE2(&src[2].colour_val.d_alpha, scale),
+            scaledColourSSE2(&src[3].colour_val.d_alpha, scale));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(argb),
+                         _mm_packus_epi16(c01, c23));
+
+        for (int v = 0; v < 4; ++v)
+        {
+            copyPositionAndUV(src[v], dst[v], xy_offset);
+            dst[v].diffuse = argb[v];
+        }
+    }
+
+    convertScalar(src, dst, count - i, xy_offset);
+}
+#endif
+
+
+//----------------------------------------------------------------------------//
+const char* VertexConversion::getKernelName()
+{
+#if defined(CEGUI_SIMD_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// return the vertex at fraction \a t of the way from \a a to \a b.
+static PackedVertex lerpVertex(const PackedVertex& a, const PackedVertex& b,
+                               float t)
+{
+    PackedVertex v;
+    v.x  = a.x + (b.x - a.x) * t;
+    v.y  = a.y + (b.y - a.y) * t;
+    v.z  = a.z + (b.z - a.z) * t;
+    v.tu = a.tu + (b.tu - a.tu) * t;
+    v.tv = a.tv + (b.tv - a.tv) * t;
+
+    v.diffuse = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        const float ca = static_cast<float>((a.diffuse >> shift) & 0xFF);
+        const float cb = static_cast<float>((b.diffuse >> shift) & 0xFF);
+        v.diffuse |= static_cast<argb_t>(ca + (cb - ca) * t + 0.5f) << shift;
+    }
+
+    return v;
+}
+
+//----------------------------------------------------------------------------//
+// signed distance of \a v inside the clip edge \a edge (left, top, right,
+// bottom) of \a r; negative values are outside.
+static inline float edgeDistance(const PackedVertex& v, const Rect& r,
+                                 int edge)
+{
+    switch (edge)
+    {
+    case 0:  return v.x - r.d_left;
+    case 1:  return v.y - r.d_top;
+    case 2:  return r.d_right - v.x;
+    default: return r.d_bottom - v.y;
+    }
+}
+
+//----------------------------------------------------------------------------//
+uint VertexConversion::appendClippedTriangles(const PackedVertex* src,
+                                              uint count, float dx, float dy,
+                                              const Rect& clip_rect,
+                                              std::vector<PackedVertex>& out)
+{
+    const size_t start = out.size();
+
+    if (clip_rect.d_right <= clip_rect.d_left ||
+        clip_rect.d_bottom <= clip_rect.d_top)
+        return 0;
+
+    // a triangle clipped to four edges has at most seven vertices.
+    PackedVertex poly[2][9];
+
+    for (uint i = 0; i + 3 <= count; i += 3, src += 3)
+    {
+        PackedVertex* in = poly[0];
+        uint in_count = 3;
+        bool inside = true;
+
+        for (uint v = 0; v < 3; ++v)
+        {
+            in[v] = src[v];
+            in[v].x += dx;
+            in[v].y += dy;
+
+            inside = inside &&
+                     in[v].x >= clip_rect.d_left &&
+                     in[v].x <= clip_rect.d_right &&
+                     in[v].y >= clip_rect.d_top &&
+                     in[v].y <= clip_rect.d_bottom;
+        }
+
+        // common case: the whole triangle is visible.
+        if (inside)
+        {
+            out.insert(out.end(), in, in + 3);
+            continue;
+        }
+
+        // Sutherland-Hodgman against each edge of the clip rect in turn.
+        for (int edge = 0; edge < 4 && in_count; ++edge)
+        {
+            PackedVertex* const res = (in == poly[0]) ? poly[1] : poly[0];
+            uint res_count = 0;
+
+            for (uint v = 0; v < in_count; ++v)
+            {
+                const PackedVertex& a = in[v];
+                const PackedVertex& b = in[(v + 1) % in_count];
+                const float da = edgeDistance(a, clip_rect, edge);
+                const float db = edgeDistance(b, clip_rect, edge);
+
+                if (da >= 0)
+                    res[res_count++] = a;
+
+                if ((da >= 0) != (db >= 0))
+                    res[res_count++] = lerpVertex(a, b, da / (da - db));
+            }
+
+            in = res;
+            in_count = res_count;
+        }
+
+        // triangulate what remains as a fan.
+        for (uint v = 2; v < in_count; ++v)
+        {
+            out.push_back(in[0]);
+            out.push_back(in[v - 1]);
+            out.push_back(in[v]);
+        }
+    }
+
+    return static_cast<uint>(out.size() - start);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
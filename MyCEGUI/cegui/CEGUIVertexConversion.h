@@ -0,0 +1,123 @@
+#pragma once
+
+#include "CEGUIBase.h"
+#include "CEGUIcolour.h"
+#include "CEGUIRect.h"
+
+#include <vector>
+
+// Use the SSE2 vertex conversion kernel where the compiler targets SSE2.
+// Define CEGUI_NO_SIMD to force the portable scalar kernel.
+#if !defined(CEGUI_NO_SIMD)
+#   if defined(__SSE2__) || defined(_M_X64) || \
+       (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#       define CEGUI_SIMD_SSE2
+#   endif
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Vertex format used by the renderer modules for their device side vertex
+    buffers: position, 32 bit ARGB diffuse colour, and texture co-ordinates.
+
+    This matches the D3DFVF_XYZ | D3DFVF_DIFFUSE | D3DFVF_TEX1 layout.
+*/
+struct PackedVertex
+{
+    //! The position for the vertex.
+    float x, y, z;
+    //! colour of the vertex.
+    argb_t diffuse;
+    //! texture coordinates.
+    float tu, tv;
+};
+
+/*!
+\brief
+    Batch conversion of CEGUI::Vertex arrays into PackedVertex arrays.
+
+    Renderer modules use this in place of converting each vertex individually,
+    which is dominated by the lazily cached colour::getARGB.  Colours are
+    packed directly from their float components several vertices at a time
+    using SSE2 where the compiler targets it, with a scalar kernel otherwise.
+    Both kernels produce identical results for colour components in the
+    range [0, 1].
+*/
+class VertexConversion
+{
+public:
+    /*!
+    \brief
+        Convert \a count vertices from \a src into \a dst, using the fastest
+        kernel available in this build.
+
+    \param src
+        Pointer to the first Vertex to convert.
+
+    \param dst
+        Pointer to storage for \a count PackedVertex objects.
+
+    \param count
+        Number of vertices to convert.
+
+    \param xy_offset
+        Value added to the x and y co-ordinates of every vertex; for example
+        -0.5f to map pixel centres to texel centres under Direct3D 9.
+    */
+    static void convert(const Vertex* src, PackedVertex* dst, uint count,
+                        float xy_offset = 0.0f);
+
+    //! Portable scalar kernel; same arguments as convert.
+    static void convertScalar(const Vertex* src, PackedVertex* dst, uint count,
+                              float xy_offset = 0.0f);
+
+#if defined(CEGUI_SIMD_SSE2)
+    //! SSE2 kernel; same arguments as convert.
+    static void convertSSE2(const Vertex* src, PackedVertex* dst, uint count,
+                            float xy_offset = 0.0f);
+#endif
+
+    //! Return the name of the kernel used by convert ("SSE2" or "scalar").
+    static const char* getKernelName();
+
+    /*!
+    \brief
+        Translate a triangle list and clip it to a rectangle on the CPU,
+        appending the result to \a out.
+
+        This allows geometry that would otherwise be drawn with its own
+        translation and scissor rectangle to be drawn as part of a larger
+        batch.  Triangles wholly inside \a clip_rect are copied as they are;
+        triangles crossing its edges are cut, with colours and texture
+        co-ordinates interpolated, and the remaining polygon re-triangulated.
+
+    \param src
+        Pointer to the first vertex of the triangle list.
+
+    \param count
+        Number of vertices in the triangle list (a multiple of three).
+
+    \param dx
+        Offset added to the x co-ordinate of each vertex before clipping.
+
+    \param dy
+        Offset added to the y co-ordinate of each vertex before clipping.
+
+    \param clip_rect
+        Rect that the translated triangles are to be clipped to.
+
+    \param out
+        vector that the resulting triangle list is appended to.
+
+    \return
+        Number of vertices appended to \a out.
+    */
+    static uint appendClippedTriangles(const PackedVertex* src, uint count,
+                                       float dx, float dy,
+                                       const Rect& clip_rect,
+                                       std::vector<PackedVertex>& out);
+};
+
+}
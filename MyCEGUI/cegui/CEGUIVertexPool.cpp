@@ -0,0 +1,95 @@
+#include "CEGUIVertexPool.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+VertexPool::VertexPool(uint capacity) :
+    d_capacity(capacity),
+    d_head(0),
+    // start at 1 so that a default constructed Allocation is never valid.
+    d_lap(1),
+    d_uploaded(0),
+    d_reused(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+uint VertexPool::getCapacity() const
+{
+    return d_capacity;
+}
+
+//----------------------------------------------------------------------------//
+bool VertexPool::allocate(uint count, Allocation& alloc)
+{
+    if (!count || count > d_capacity)
+        return false;
+
+    // ranges are always contiguous, so wrap early if this one will not fit.
+    if (count > d_capacity - d_head)
+    {
+        d_head = 0;
+        ++d_lap;
+    }
+
+    alloc.d_offset = d_head;
+    alloc.d_capacity = count;
+    alloc.d_lap = d_lap;
+
+    d_head += count;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool VertexPool::isValid(const Allocation& alloc) const
+{
+    // a range stays valid for the rest of the lap it was handed out in, and
+    // into the next lap until the head reaches it again.
+    return alloc.d_capacity &&
+           ((alloc.d_lap == d_lap) ||
+            (alloc.d_lap + 1 == d_lap && d_head <= alloc.d_offset));
+}
+
+//----------------------------------------------------------------------------//
+void VertexPool::invalidateAll()
+{
+    d_head = 0;
+    d_lap += 2;
+}
+
+//----------------------------------------------------------------------------//
+void VertexPool::recordUpload(uint count)
+{
+    d_uploaded += count;
+}
+
+//----------------------------------------------------------------------------//
+void VertexPool::recordReuse(uint count)
+{
+    d_reused += count;
+}
+
+//----------------------------------------------------------------------------//
+uint VertexPool::getUploadedVertexCount() const
+{
+    return d_uploaded;
+}
+
+//----------------------------------------------------------------------------//
+uint VertexPool::getReusedVertexCount() const
+{
+    return d_reused;
+}
+
+//----------------------------------------------------------------------------//
+void VertexPool::resetFrameCounters()
+{
+    d_uploaded = 0;
+    d_reused = 0;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
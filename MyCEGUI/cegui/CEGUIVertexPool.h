@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CEGUIBase.h"
+
+namespace CEGUI
+{
+/*!
+\brief
+    Ring allocator for ranges of a renderer owned, fixed size vertex store.
+
+    Renderer modules use a VertexPool to hand out space in one large vertex
+    store - a static vertex buffer on the GPU, or a block of system memory -
+    so that a GeometryBuffer whose content has not changed since it was last
+    drawn can be drawn again straight from the store, and a buffer that has
+    been appended to only needs its new vertices copied.
+
+    The pool does not own the storage, and allocations are never freed
+    individually: space is handed out from a head that moves around the store,
+    and when the head passes over an older allocation that allocation becomes
+    invalid.  The owner of an Allocation checks it with isValid before each
+    use and, when it has been lost, allocates again and re-copies all of its
+    vertices.
+*/
+class VertexPool
+{
+public:
+    //! A range of vertices allocated from a VertexPool.
+    struct Allocation
+    {
+        //! index of the first vertex of the range within the store.
+        uint d_offset;
+        //! number of vertices in the range.
+        uint d_capacity;
+        //! pass of the head around the store in which the range was handed out.
+        uint d_lap;
+
+        Allocation() : d_offset(0), d_capacity(0), d_lap(0) {}
+    };
+
+    /*!
+    \brief
+        Constructor.
+
+    \param capacity
+        Number of vertices in the store that the pool manages.
+    */
+    VertexPool(uint capacity);
+
+    //! Return the number of vertices in the store that the pool manages.
+    uint getCapacity() const;
+
+    /*!
+    \brief
+        Allocate a range of \a count vertices.
+
+    \param count
+        Number of vertices required.
+
+    \param alloc
+        Allocation object that receives the range.  It is only modified if
+        the function succeeds.
+
+    \return
+        - true if the range was allocated.
+        - false if \a count is zero or larger than the whole store.
+    */
+    bool allocate(uint count, Allocation& alloc);
+
+    /*!
+    \brief
+        Return whether the range described by \a alloc is still owned by the
+        holder of \a alloc, i.e. it has not been handed out again since.
+    */
+    bool isValid(const Allocation& alloc) const;
+
+    /*!
+    \brief
+        Invalidate all existing allocations; for example because the content
+        of the store has been lost.
+    */
+    void invalidateAll();
+
+    //! Record that \a count vertices were copied into the store.
+    void recordUpload(uint count);
+
+    //! Record that \a count vertices were drawn without being copied again.
+    void recordReuse(uint count);
+
+    //! Return the number of vertices copied since resetFrameCounters.
+    uint getUploadedVertexCount() const;
+
+    //! Return the number of vertices reused since resetFrameCounters.
+    uint getReusedVertexCount() const;
+
+    //! Reset the upload and reuse counters; called once per frame.
+    void resetFrameCounters();
+
+private:
+    //! number of vertices in the store.
+    const uint d_capacity;
+    //! index of the next vertex to be handed out.
+    uint d_head;
+    //! number of times the head has wrapped around the store.
+    uint d_lap;
+    //! vertices copied since the last resetFrameCounters.
+    uint d_uploaded;
+    //! vertices reused since the last resetFrameCounters.
+    uint d_reused;
+};
+
+}
@@ -35,58 +35,58 @@
 namespace CEGUI
 {
 //----------------------------------------------------------------------------//
-const String Window::EventNamespace("Window");
-const String Window::EventWindowUpdated ("WindowUpdate");
-const String Window::EventParentSized("ParentSized");
-const String Window::EventSized("Sized");
-const String Window::EventMoved("Moved");
-const String Window::EventTextChanged("TextChanged");
-const String Window::EventFontChanged("FontChanged");
-const String Window::EventAlphaChanged("AlphaChanged");
-const String Window::EventIDChanged("IDChanged");
-const String Window::EventActivated("Activated");
-const String Window::EventDeactivated("Deactivated");
-const String Window::EventShown("Shown");
-const String Window::EventHidden("Hidden");
-const String Window::EventEnabled("Enabled");
-const String Window::EventDisabled("Disabled");
-const String Window::EventClippedByParentChanged("ClippingChanged");
-const String Window::EventDestroyedByParentChanged("DestroyedByParentChanged");
-const String Window::EventInheritsAlphaChanged("InheritAlphaChanged");
-const String Window::EventAlwaysOnTopChanged("AlwaysOnTopChanged");
-const String Window::EventInputCaptureGained("CaptureGained");
-const String Window::EventInputCaptureLost("CaptureLost");
-const String Window::EventRenderingStarted("StartRender");
-const String Window::EventRenderingEnded("EndRender");
-const String Window::EventChildAdded("AddedChild");
-const String Window::EventChildRemoved("RemovedChild");
-const String Window::EventDestructionStarted("DestructStart");
-const String Window::EventZOrderChanged("ZChanged");
-const String Window::EventDragDropItemEnters("DragDropItemEnters");
-const String Window::EventDragDropItemLeaves("DragDropItemLeaves");
-const String Window::EventDragDropItemDropped("DragDropItemDropped");
-const String Window::EventVerticalAlignmentChanged("VerticalAlignmentChanged");
-const String Window::EventHorizontalAlignmentChanged("HorizontalAlignmentChanged");
-const String Window::EventWindowRendererAttached("WindowRendererAttached");
-const String Window::EventWindowRendererDetached("WindowRendererDetached");
-const String Window::EventRotated("Rotated");
-const String Window::EventNonClientChanged("NonClientChanged");
-const String Window::EventTextParsingChanged("TextParsingChanged");
-const String Window::EventMarginChanged("MarginChanged");
-const String Window::EventMouseEntersArea("MouseEntersArea");
-const String Window::EventMouseLeavesArea("MouseLeavesArea");
-const String Window::EventMouseEnters("MouseEnter");
-const String Window::EventMouseLeaves("MouseLeave");
-const String Window::EventMouseMove("MouseMove");
-const String Window::EventMouseWheel("MouseWheel");
-const String Window::EventMouseButtonDown("MouseButtonDown");
-const String Window::EventMouseButtonUp("MouseButtonUp");
-const String Window::EventMouseClick("MouseClick");
-const String Window::EventMouseDoubleClick("MouseDoubleClick");
-const String Window::EventMouseTripleClick("MouseTripleClick");
-const String Window::EventKeyDown("KeyDown");
-const String Window::EventKeyUp("KeyUp");
-const String Window::EventCharacterKey("CharacterKey");
+const EventID Window::EventNamespace("Window");
+const EventID Window::EventWindowUpdated ("WindowUpdate");
+const EventID Window::EventParentSized("ParentSized");
+const EventID Window::EventSized("Sized");
+const EventID Window::EventMoved("Moved");
+const EventID Window::EventTextChanged("TextChanged");
+const EventID Window::EventFontChanged("FontChanged");
+const EventID Window::EventAlphaChanged("AlphaChanged");
+const EventID Window::EventIDChanged("IDChanged");
+const EventID Window::EventActivated("Activated");
+const EventID Window::EventDeactivated("Deactivated");
+const EventID Window::EventShown("Shown");
+const EventID Window::EventHidden("Hidden");
+const EventID Window::EventEnabled("Enabled");
+const EventID Window::EventDisabled("Disabled");
+const EventID Window::EventClippedByParentChanged("ClippingChanged");
+const EventID Window::EventDestroyedByParentChanged("DestroyedByParentChanged");
+const EventID Window::EventInheritsAlphaChanged("InheritAlphaChanged");
+const EventID Window::EventAlwaysOnTopChanged("AlwaysOnTopChanged");
+const EventID Window::EventInputCaptureGained("CaptureGained");
+const EventID Window::EventInputCaptureLost("CaptureLost");
+const EventID Window::EventRenderingStarted("StartRender");
+const EventID Window::EventRenderingEnded("EndRender");
+const EventID Window::EventChildAdded("AddedChild");
+const EventID Window::EventChildRemoved("RemovedChild");
+const EventID Window::EventDestructionStarted("DestructStart");
+const EventID Window::EventZOrderChanged("ZChanged");
+const EventID Window::EventDragDropItemEnters("DragDropItemEnters");
+const EventID Window::EventDragDropItemLeaves("DragDropItemLeaves");
+const EventID Window::EventDragDropItemDropped("DragDropItemDropped");
+const EventID Window::EventVerticalAlignmentChanged("VerticalAlignmentChanged");
+const EventID Window::EventHorizontalAlignmentChanged("HorizontalAlignmentChanged");
+const EventID Window::EventWindowRendererAttached("WindowRendererAttached");
+const EventID Window::EventWindowRendererDetached("WindowRendererDetached");
+const EventID Window::EventRotated("Rotated");
+const EventID Window::EventNonClientChanged("NonClientChanged");
+const EventID Window::EventTextParsingChanged("TextParsingChanged");
+const EventID Window::EventMarginChanged("MarginChanged");
+const EventID Window::EventMouseEntersArea("MouseEntersArea");
+const EventID Window::EventMouseLeavesArea("MouseLeavesArea");
+const EventID Window::EventMouseEnters("MouseEnter");
+const EventID Window::EventMouseLeaves("MouseLeave");
+const EventID Window::EventMouseMove("MouseMove");
+const EventID Window::EventMouseWheel("MouseWheel");
+const EventID Window::EventMouseButtonDown("MouseButtonDown");
+const EventID Window::EventMouseButtonUp("MouseButtonUp");
+const EventID Window::EventMouseClick("MouseClick");
+const EventID Window::EventMouseDoubleClick("MouseDoubleClick");
+const EventID Window::EventMouseTripleClick("MouseTripleClick");
+const EventID Window::EventKeyDown("KeyDown");
+const EventID Window::EventKeyUp("KeyUp");
+const EventID Window::EventCharacterKey("CharacterKey");
 
 //----------------------------------------------------------------------------//
 const String Window::TooltipNameSuffix("__auto_tooltip__");
@@ -173,6 +173,7 @@ Window::Window(const String& type, const String& name) :
     d_geometry(&System::getSingleton().getRenderer()->createGeometryBuffer()),
     d_surface(0),
     d_needsRedraw(true),
+    d_redrawReason(RenderProfiler::RR_Initial),
     d_autoRenderingWindow(false),
     d_mouseCursor((const Image*)DefaultMouseCursor),
 
@@ -230,6 +231,7 @@ Window::Window(const String& type, const String& name) :
     d_customTip(0),
     d_weOwnTip(false),
     d_inheritsTipText(true),
+    d_tooltipTimerActive(false),
 
     // XML writing options
     d_allowWriteXML(true),
@@ -272,6 +274,13 @@ Window::~Window(void)
 {
     // most cleanup actually happened earlier in Window::destroy.
 
+    cancelScheduledUpdate();
+    System::getSingleton().getEventQueue().cancel(*this);
+
+    RenderProfiler& profiler = System::getSingleton().getRenderProfiler();
+    if (profiler.isEnabled())
+        profiler.removeBufferOwner(*d_geometry);
+
     System::getSingleton().getRenderer()->destroyGeometryBuffer(*d_geometry);
     delete d_bidiVisualMapping;
 }
@@ -309,12 +318,12 @@ bool Window::isActive(void) const
 }
 
 //----------------------------------------------------------------------------//
-bool Window::isChild(const String& name) const
+bool Window::isChild(const StringView& name) const
 {
     const size_t child_count = getChildCount();
 
     for (size_t i = 0; i < child_count; ++i)
-        if (d_children[i]->getName() == name)
+        if (name == d_children[i]->getName())
             return true;
 
     return false;
@@ -357,16 +366,16 @@ bool Window::isChild(const Window* window) const
 }
 
 //----------------------------------------------------------------------------//
-Window* Window::getChild(const String& name) const
+Window* Window::getChild(const StringView& name) const
 {
     const size_t child_count = getChildCount();
 
     for (size_t i = 0; i < child_count; ++i)
-        if (d_children[i]->getName() == name)
+        if (name == d_children[i]->getName())
             return d_children[i];
 
     CEGUI_THROW(UnknownObjectException("Window::getChild - The Window object "
-        "named '" + name + "' is not attached to Window '" + d_name + "'."));
+        "named '" + name.str() + "' is not attached to Window '" + d_name + "'."));
 }
 
 //----------------------------------------------------------------------------//
@@ -385,14 +394,13 @@ Window* Window::getChild(uint ID) const
 }
 
 //----------------------------------------------------------------------------//
-Window* Window::getChildRecursive(const String& name) const
+Window* Window::getChildRecursive(const StringView& name) const
 {
     const size_t child_count = getChildCount();
 
     for (size_t i = 0; i < child_count; ++i)
     {
-        const String childName(d_children[i]->getName());
-        if (childName == name)
+        if (name == d_children[i]->getName())
             return d_children[i];
 
         Window* tmp = d_children[i]->getChildRecursive(name);
@@ -1135,8 +1143,18 @@ void Window::invalidate(void)
 //----------------------------------------------------------------------------//
 void Window::invalidate(const bool recursive)
 {
+    if (!d_needsRedraw)
+        d_redrawReason = RenderProfiler::RR_Invalidated;
+
     invalidate_impl(recursive);
-    System::getSingleton().signalRedraw();
+
+    // only the area we cover has changed; unless child content outside of it
+    // is affected too, or we are drawn via a RenderingWindow, which may be
+    // transformed on its way to the display.
+    if (recursive || getTargetRenderingSurface().isRenderingWindow())
+        System::getSingleton().signalRedraw();
+    else
+        System::getSingleton().signalRedraw(getOuterRectClipper());
 }
 
 //----------------------------------------------------------------------------//
@@ -1149,7 +1167,13 @@ void Window::invalidate_impl(const bool recursive)
     {
         const size_t child_count = getChildCount();
         for (size_t i = 0; i < child_count; ++i)
+        {
+            if (!d_children[i]->d_needsRedraw)
+                d_children[i]->d_redrawReason =
+                    RenderProfiler::RR_ParentInvalidated;
+
             d_children[i]->invalidate_impl(true);
+        }
     }
 }
 
@@ -1160,6 +1184,13 @@ void Window::render()
     if (!isVisible())
         return;
 
+    RenderProfiler& profiler = System::getSingleton().getRenderProfiler();
+    const double start =
+        profiler.isEnabled() ? RenderProfiler::getTimestamp() : 0;
+
+    if (profiler.isEnabled())
+        profiler.setBufferOwner(*d_geometry, *this);
+
     // get rendering context
     RenderingContext ctx;
     getRenderingContext(ctx);
@@ -1183,6 +1214,9 @@ void Window::render()
     // do final rendering for surface if it's ours
     if (ctx.owner == this)
         ctx.surface->draw();
+
+    if (profiler.isEnabled())
+        profiler.recordScope(RenderProfiler::S_Render, *this, start);
 }
 
 //----------------------------------------------------------------------------//
@@ -1197,6 +1231,10 @@ void Window::bufferGeometry(const RenderingContext&)
 {
     if (d_needsRedraw)
     {
+        RenderProfiler& profiler = System::getSingleton().getRenderProfiler();
+        const double start =
+            profiler.isEnabled() ? RenderProfiler::getTimestamp() : 0;
+
         // dispose of already cached geometry.
         d_geometry->reset();
 
@@ -1207,24 +1245,48 @@ void Window::bufferGeometry(const RenderingContext&)
         // HACK: ensure our rendered string content is up to date
         getRenderedString();
 
+        const double populate_start =
+            profiler.isEnabled() ? RenderProfiler::getTimestamp() : 0;
+
         // get derived class or WindowRenderer to re-populate geometry buffer.
         if (d_windowRenderer)
             d_windowRenderer->render();
         else
             populateGeometryBuffer();
 
+        if (profiler.isEnabled())
+        {
+            profiler.recordGeometry(*this, d_geometry->getVertexCount(),
+                                    d_redrawReason);
+            profiler.recordScope(RenderProfiler::S_Populate, *this,
+                                 populate_start);
+        }
+
         // signal rendering ended
         args.handled = 0;
         onRenderingEnded(args);
 
         // mark ourselves as no longer needed a redraw.
         d_needsRedraw = false;
+        d_redrawReason = RenderProfiler::RR_None;
+
+        if (profiler.isEnabled())
+            profiler.recordScope(RenderProfiler::S_BufferGeometry, *this,
+                                 start);
     }
 }
 
 //----------------------------------------------------------------------------//
 void Window::queueGeometry(const RenderingContext& ctx)
 {
+    // under partial redraw, geometry drawn straight to the display outside
+    // of the area being redrawn would be clipped away by the Renderer.  The
+    // content of a RenderingWindow is kept between frames, so it is always
+    // queued in full.
+    if (!ctx.surface->isRenderingWindow() &&
+        !System::getSingleton().isInRedrawRegion(getOuterRectClipper()))
+        return;
+
     // add geometry so that it gets drawn to the target surface.
     ctx.surface->addGeometryBuffer(ctx.queue, *d_geometry);
 }
@@ -1305,6 +1367,9 @@ void Window::addChild_impl(Window* wnd)
     // set the parent window
     wnd->setParent(this);
 
+    // the window may have been moved into the active GUI sheet.
+    System::getSingleton().getTimePulseScheduler().resumeParked(wnd);
+
     // update area rects and content for the added window
     wnd->notifyScreenAreaChanged(true);
     wnd->invalidate(true);
@@ -1597,14 +1662,7 @@ void Window::setAutoRepeatRate(float rate)
 void Window::update(float elapsed)
 {       
     // perform update for 'this' Window
-    updateSelf(elapsed);
-
-    // update underlying RenderingWinodw if needed
-    if (d_surface && d_surface->isRenderingWindow())
-        static_cast<RenderingWindow*>(d_surface)->update(elapsed);
-
-    UpdateEventArgs e(this,elapsed);
-    fireEvent(EventWindowUpdated,e,EventNamespace);
+    update_impl(elapsed);
 
     // update child windows
     for (size_t i = 0; i < getChildCount(); ++i)
@@ -1619,6 +1677,94 @@ void Window::update(float elapsed)
     }
 }
 
+//----------------------------------------------------------------------------//
+void Window::update_impl(float elapsed)
+{
+    updateSelf(elapsed);
+
+    // update underlying RenderingWinodw if needed
+    if (d_surface && d_surface->isRenderingWindow())
+        static_cast<RenderingWindow*>(d_surface)->update(elapsed);
+
+    UpdateEventArgs e(this,elapsed);
+    fireEvent(EventWindowUpdated,e,EventNamespace);
+}
+
+//----------------------------------------------------------------------------//
+void Window::scheduleUpdate(float delay)
+{
+    System& sys = System::getSingleton();
+
+    if (sys.isScheduledTimePulsesEnabled())
+        sys.getTimePulseScheduler().schedule(*this, delay);
+}
+
+//----------------------------------------------------------------------------//
+void Window::cancelScheduledUpdate()
+{
+    System::getSingleton().getTimePulseScheduler().cancel(*this);
+}
+
+//----------------------------------------------------------------------------//
+bool Window::needsContinuousUpdate() const
+{
+    if (d_surface && d_surface->isRenderingWindow())
+        return true;
+
+    // a tooltip counts its hover, display and fade times in its update.
+    if (d_tooltipTimerActive)
+        return true;
+
+    const Event* const ev = getEventObject(EventWindowUpdated);
+
+    return ev && ev->getConnectionCount();
+}
+
+//----------------------------------------------------------------------------//
+Event::Connection Window::subscribeEvent(const EventID& name,
+                                         Event::Subscriber subscriber)
+{
+    Event::Connection c(EventSet::subscribeEvent(name, subscriber));
+
+    if (name == EventWindowUpdated)
+        scheduleUpdate(0);
+
+    return c;
+}
+
+//----------------------------------------------------------------------------//
+Event::Connection Window::subscribeEvent(const EventID& name,
+                                         Event::Group group,
+                                         Event::Subscriber subscriber)
+{
+    Event::Connection c(EventSet::subscribeEvent(name, group, subscriber));
+
+    if (name == EventWindowUpdated)
+        scheduleUpdate(0);
+
+    return c;
+}
+
+//----------------------------------------------------------------------------//
+void Window::fireEvent(const EventID& name, EventArgs& args,
+                       const EventID& eventNamespace)
+{
+    EventQueue& queue = System::getSingleton().getEventQueue();
+
+    if (queue.isDeferred(name))
+        queue.post(*this, name, eventNamespace);
+    else
+        EventSet::fireEvent(name, args, eventNamespace);
+}
+
+//----------------------------------------------------------------------------//
+void Window::fireTypedEvent(TypedEvent<MouseEventArgs>& ev,
+                            const EventID& name, MouseEventArgs& args)
+{
+    if (!d_muted && !System::getSingleton().getEventQueue().isDeferred(name))
+        ev(args);
+}
+
 //----------------------------------------------------------------------------//
 void Window::updateSelf(float elapsed)
 {
@@ -1646,6 +1792,11 @@ void Window::updateSelf(float elapsed)
                 generateAutoRepeatEvent(d_repeatButton);
             }
         }
+
+        // with scheduled time pulses, wake up again for the next repeat.
+        if (d_repeatButton != NoButton)
+            scheduleUpdate((d_repeating ? d_repeatRate : d_repeatDelay) -
+                           d_repeatElapsed);
     }
 
     // allow for updates within an assigned WindowRenderer
@@ -1720,11 +1871,12 @@ void Window::destroy(void)
     onDestructionStarted(args);
 
     releaseInput();
+    cancelScheduledUpdate();
 
     // let go of the tooltip if we have it
     Tooltip* const tip = getTooltip();
     if (tip && tip->getTargetWindow()==this)
-        tip->setTargetWindow(0);
+        setTooltipTarget(*tip, 0);
 
     // ensure custom tooltip is cleaned up
     setTooltip(static_cast<Tooltip*>(0));
@@ -2526,6 +2678,8 @@ void Window::onSized(WindowEventArgs& e)
     }
 
     invalidate();
+    // the area we used to cover has to be redrawn too.
+    System::getSingleton().signalRedraw();
 
     fireEvent(EventSized, e, EventNamespace);
 }
@@ -2544,6 +2698,10 @@ void Window::onMoved(WindowEventArgs& e)
             System::getSingleton().signalRedraw();
     }
 
+    // with partial redraw, the area we moved away from needs redrawing too.
+    if (System::getSingleton().isPartialRedrawEnabled())
+        System::getSingleton().signalRedraw();
+
     fireEvent(EventMoved, e, EventNamespace);
 }
 
@@ -2596,6 +2754,10 @@ void Window::onIDChanged(WindowEventArgs& e)
 void Window::onShown(WindowEventArgs& e)
 {
     invalidate();
+    // children that are not clipped by us may appear outside of our area.
+    System::getSingleton().signalRedraw();
+    // scheduled updates held back while we were hidden may now be delivered.
+    System::getSingleton().getTimePulseScheduler().resumeParked(this);
     fireEvent(EventShown, e, EventNamespace);
 }
 
@@ -2607,6 +2769,8 @@ void Window::onHidden(WindowEventArgs& e)
         deactivate();
 
     invalidate();
+    // children that are not clipped by us may disappear outside of our area.
+    System::getSingleton().signalRedraw();
     fireEvent(EventHidden, e, EventNamespace);
 }
 
@@ -2653,6 +2817,8 @@ void Window::onClippingChanged(WindowEventArgs& e)
 {
     invalidate();
     notifyClippingChanged();
+    // the area we may draw to has changed in a way the clippers do not show.
+    System::getSingleton().signalRedraw();
     fireEvent(EventClippedByParentChanged, e, EventNamespace);
 }
 
@@ -2837,7 +3003,7 @@ void Window::onMouseEnters(MouseEventArgs& e)
     // perform tooltip control
     Tooltip* const tip = getTooltip();
     if (tip && !isAncestor(tip))
-        tip->setTargetWindow(this);
+        setTooltipTarget(*tip, this);
 
     fireEvent(EventMouseEnters, e, EventNamespace);
 }
@@ -2849,7 +3015,7 @@ void Window::onMouseLeaves(MouseEventArgs& e)
     const Window* const mw = System::getSingleton().getWindowContainingMouse();
     Tooltip* const tip = getTooltip();
     if (tip && mw != tip && !(mw && mw->isAncestor(tip)))
-        tip->setTargetWindow(0);
+        setTooltipTarget(*tip, 0);
 
     fireEvent(EventMouseLeaves, e, EventNamespace);
 }
@@ -2860,9 +3026,13 @@ void Window::onMouseMove(MouseEventArgs& e)
     // perform tooltip control
     Tooltip* const tip = getTooltip();
     if (tip)
+    {
         tip->resetTimer();
+        tip->scheduleUpdate(0);
+    }
 
     fireEvent(EventMouseMove, e, EventNamespace);
+    fireTypedEvent(d_mouseMoveEvent, EventMouseMove, e);
 
     // optionally propagate to parent
     if (!e.handled && d_propagateMouseInputs &&
@@ -2883,6 +3053,7 @@ void Window::onMouseMove(MouseEventArgs& e)
 void Window::onMouseWheel(MouseEventArgs& e)
 {
     fireEvent(EventMouseWheel, e, EventNamespace);
+    fireTypedEvent(d_mouseWheelEvent, EventMouseWheel, e);
 
     // optionally propagate to parent
     if (!e.handled && d_propagateMouseInputs &&
@@ -2905,7 +3076,7 @@ void Window::onMouseButtonDown(MouseEventArgs& e)
     // perform tooltip control
     Tooltip* const tip = getTooltip();
     if (tip)
-        tip->setTargetWindow(0);
+        setTooltipTarget(*tip, 0);
 
     if ((e.button == LeftButton) && moveToFront_impl(true))
         ++e.handled;
@@ -2923,10 +3094,12 @@ void Window::onMouseButtonDown(MouseEventArgs& e)
             d_repeatButton = e.button;
             d_repeatElapsed = 0;
             d_repeating = false;
+            scheduleUpdate(d_repeatDelay);
         }
     }
 
     fireEvent(EventMouseButtonDown, e, EventNamespace);
+    fireTypedEvent(d_mouseButtonDownEvent, EventMouseButtonDown, e);
 
     // optionally propagate to parent
     if (!e.handled && d_propagateMouseInputs &&
@@ -2954,6 +3127,7 @@ void Window::onMouseButtonUp(MouseEventArgs& e)
     }
 
     fireEvent(EventMouseButtonUp, e, EventNamespace);
+    fireTypedEvent(d_mouseButtonUpEvent, EventMouseButtonUp, e);
 
     // optionally propagate to parent
     if (!e.handled && d_propagateMouseInputs &&
@@ -3515,6 +3689,9 @@ void Window::setRenderingSurface(RenderingSurface* surface)
     {
         transferChildSurfaces();
         notifyScreenAreaChanged();
+
+        if (d_surface->isRenderingWindow())
+            scheduleUpdate(0);
     }
 }
 
@@ -3583,6 +3760,7 @@ void Window::allocateRenderingWindow()
         }
 
         d_surface = &getTargetRenderingSurface().createRenderingWindow(*t);
+        scheduleUpdate(0);
         transferChildSurfaces();
 
         // set size and position of RenderingWindow
@@ -3679,6 +3857,16 @@ void Window::initialiseClippers(const RenderingContext& ctx)
     }
 }
 
+//----------------------------------------------------------------------------//
+void Window::setTooltipTarget(Tooltip& tip, Window* target)
+{
+    tip.setTargetWindow(target);
+    tip.d_tooltipTimerActive = (target != 0);
+
+    if (target)
+        tip.scheduleUpdate(0);
+}
+
 //----------------------------------------------------------------------------//
 bool Window::isNonClientWindow() const
 {
@@ -3961,6 +4149,7 @@ void Window::moveBehind(const Window* const window)
 void Window::setUpdateMode(const WindowUpdateMode mode)
 {
     d_updateMode = mode;
+    System::getSingleton().getTimePulseScheduler().resumeParked(this);
 }
 
 //----------------------------------------------------------------------------//
@@ -2,6 +2,7 @@
 
 #include "CEGUIBase.h"
 #include "CEGUIString.h"
+#include "CEGUIStringView.h"
 #include "CEGUIVector.h"
 #include "CEGUIRect.h"
 #include "CEGUISize.h"
@@ -9,6 +10,7 @@
 #include "CEGUIPropertySet.h"
 #include "CEGUISystem.h"
 #include "CEGUIInputEvent.h"
+#include "CEGUITypedEvent.h"
 #include "CEGUIWindowProperties.h"
 #include "CEGUIUDim.h"
 #include "CEGUIWindowRenderer.h"
@@ -66,33 +68,33 @@ public:
         Event name constants
     *************************************************************************/
     //! Namespace for global events
-    static const String EventNamespace;
-    static const String EventWindowUpdated;
+    static const EventID EventNamespace;
+    static const EventID EventWindowUpdated;
     //windowָǸڵָ
-    static const String EventParentSized;
+    static const EventID EventParentSized;
     //ڴСı
-    static const String EventSized;
+    static const EventID EventSized;
     //λ÷ı
-    static const String EventMoved;
-    static const String EventTextChanged;
-    static const String EventFontChanged;
-    static const String EventAlphaChanged;
-    static const String EventIDChanged;
+    static const EventID EventMoved;
+    static const EventID EventTextChanged;
+    static const EventID EventFontChanged;
+    static const EventID EventAlphaChanged;
+    static const EventID EventIDChanged;
 	//windowýĴڣotherwindowʧȥĴ
-    static const String EventActivated;
+    static const EventID EventActivated;
     //windowʧȥĴڣwindowýĴ
-    static const String EventDeactivated;
-    static const String EventShown;
-    static const String EventHidden;
-    static const String EventEnabled;
-    static const String EventDisabled;
-    static const String EventClippedByParentChanged;
-    static const String EventDestroyedByParentChanged;
-    static const String EventInheritsAlphaChanged;
-    static const String EventAlwaysOnTopChanged;
-    static const String EventInputCaptureGained;
+    static const EventID EventDeactivated;
+    static const EventID EventShown;
+    static const EventID EventHidden;
+    static const EventID EventEnabled;
+    static const EventID EventDisabled;
+    static const EventID EventClippedByParentChanged;
+    static const EventID EventDestroyedByParentChanged;
+    static const EventID EventInheritsAlphaChanged;
+    static const EventID EventAlwaysOnTopChanged;
+    static const EventID EventInputCaptureGained;
 	//ͷ룬windowָǣwindowָǻĴ
-    static const String EventInputCaptureLost;
+    static const EventID EventInputCaptureLost;
     /** Event fired when rendering of the Window has started.  In this context
      * 'rendering' is the population of the GeometryBuffer with geometry for the
      * window, not the actual rendering of that GeometryBuffer content to the 
@@ -100,13 +102,13 @@ public:
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose rendering has started.
      */
-    static const String EventRenderingStarted;
-    static const String EventRenderingEnded;
+    static const EventID EventRenderingStarted;
+    static const EventID EventRenderingEnded;
     //windowָӴ
-    static const String EventChildAdded;
-    static const String EventChildRemoved;
-    static const String EventDestructionStarted;
-    static const String EventZOrderChanged;
+    static const EventID EventChildAdded;
+    static const EventID EventChildRemoved;
+    static const EventID EventDestructionStarted;
+    static const EventID EventZOrderChanged;
     /** Event fired when a DragContainer is dragged in to the window's area.
      * Handlers are passed a const DragDropEventArgs reference with
      * WindowEventArgs::window set to the window over which a DragContainer has
@@ -114,7 +116,7 @@ public:
      * set to the DragContainer that was dragged in to the receiving window's
      * area.
      */
-    static const String EventDragDropItemEnters;
+    static const EventID EventDragDropItemEnters;
     /** Event fired when a DragContainer is dragged out of the window's area.
      * Handlers are passed a const DragDropEventArgs reference with
      * WindowEventArgs::window set to the window over which a DragContainer has
@@ -122,40 +124,40 @@ public:
      * DragDropEventArgs::dragDropItem set to the DragContainer that was dragged
      * out of the receiving window's area.
      */
-    static const String EventDragDropItemLeaves;
+    static const EventID EventDragDropItemLeaves;
     /** Event fired when a DragContainer is dropped within the window's area.
      * Handlers are passed a const DragDropEventArgs reference with
      * WindowEventArgs::window set to the window over which a DragContainer was
      * dropped (the receiving window) and DragDropEventArgs::dragDropItem set to
      * the DragContainer that was dropped within the receiving window's area.
      */
-    static const String EventDragDropItemDropped;
-    static const String EventVerticalAlignmentChanged;
-    static const String EventHorizontalAlignmentChanged;
-    static const String EventWindowRendererAttached;
-    static const String EventWindowRendererDetached;
-    static const String EventRotated;
-    static const String EventNonClientChanged;
-    static const String EventTextParsingChanged;
-    static const String EventMarginChanged;
-    static const String EventMouseEntersArea;
-    static const String EventMouseLeavesArea;
+    static const EventID EventDragDropItemDropped;
+    static const EventID EventVerticalAlignmentChanged;
+    static const EventID EventHorizontalAlignmentChanged;
+    static const EventID EventWindowRendererAttached;
+    static const EventID EventWindowRendererDetached;
+    static const EventID EventRotated;
+    static const EventID EventNonClientChanged;
+    static const EventID EventTextParsingChanged;
+    static const EventID EventMarginChanged;
+    static const EventID EventMouseEntersArea;
+    static const EventID EventMouseLeavesArea;
     //Ӵʱڲᴥ¼
-    static const String EventMouseEnters;
-    static const String EventMouseLeaves;
-    static const String EventMouseMove;
-    static const String EventMouseWheel;
-    static const String EventMouseButtonDown;
-    static const String EventMouseButtonUp;
+    static const EventID EventMouseEnters;
+    static const EventID EventMouseLeaves;
+    static const EventID EventMouseMove;
+    static const EventID EventMouseWheel;
+    static const EventID EventMouseButtonDown;
+    static const EventID EventMouseButtonUp;
     //һʱdown and up
-    static const String EventMouseClick;
-    static const String EventMouseDoubleClick;
-    static const String EventMouseTripleClick;
+    static const EventID EventMouseClick;
+    static const EventID EventMouseDoubleClick;
+    static const EventID EventMouseTripleClick;
     //Ĵڴ¼
-    static const String EventKeyDown;
-    static const String EventKeyUp;
+    static const EventID EventKeyDown;
+    static const EventID EventKeyUp;
 	//UTF32ʽַ
-    static const String EventCharacterKey;
+    static const EventID EventCharacterKey;
 
     /*************************************************************************
         Child Widget name suffix constants
@@ -181,7 +183,7 @@ public:
     uint getID(void) const {return d_ID;}
     size_t getChildCount(void) const  {return d_children.size();}
 	//ûвزһҵ
-    bool isChild(const String& name) const;
+    bool isChild(const StringView& name) const;
 	//ûвزһҵ
     bool isChild(uint ID) const;
 	//ݹӴв
@@ -189,12 +191,12 @@ public:
     bool isChild(const Window* window) const;
 	//أһҵ
     //exception UnknownObjectException thrown if no window named \a name is attached to this Window.
-    Window* getChild(const String& name) const;
+    Window* getChild(const StringView& name) const;
 	//أһҵ
     //exception UnknownObjectException thrown if no window with the ID code \a ID is attached to this Window.
     Window* getChild(uint ID) const;
 	//ô۸ߣ׳쳣0
-    Window* getChildRecursive(const String& name) const;
+    Window* getChildRecursive(const StringView& name) const;
     Window* getChildRecursive(uint ID) const;
     Window* getChildAtIdx(size_t idx) const {return d_children[idx];}
 	//ҵϲļӴ
@@ -911,6 +913,66 @@ public:
 	//ڸԼ綨ʱ
     virtual void update(float elapsed);
 
+    /*!
+    \brief
+        Request that this window is updated once \a delay seconds of time
+        pulses have passed, replacing any earlier request.
+
+        This only has an effect while scheduled time pulses are enabled (see
+        System::setScheduledTimePulsesEnabled), in which case a time pulse
+        updates only windows with a due request.  Requests are one-shot;
+        window code that needs further updates requests again from within
+        updateSelf.
+
+    \param delay
+        Time in seconds, of time pulses, until the update.  0 requests an
+        update at the next time pulse.
+    */
+    void scheduleUpdate(float delay);
+
+    //! Cancel any update requested via scheduleUpdate.
+    void cancelScheduledUpdate();
+
+    using EventSet::fireEvent;
+    /*!
+    \brief
+        Overridden to queue the events deferred via the System's EventQueue
+        instead of firing them, see EventQueue.
+    */
+    void fireEvent(const EventID& name, EventArgs& args,
+                   const EventID& eventNamespace);
+
+    using EventSet::subscribeEvent;
+    // overridden to keep windows with EventWindowUpdated subscribers updated
+    // when scheduled time pulses are enabled.
+    Event::Connection subscribeEvent(const EventID& name,
+                                     Event::Subscriber subscriber);
+    Event::Connection subscribeEvent(const EventID& name, Event::Group group,
+                                     Event::Subscriber subscriber);
+
+    /*!
+    \brief
+        Return the TypedEvent fired along with EventMouseMove.  Its handlers
+        take the MouseEventArgs directly and are called without virtual
+        dispatch, see TypedEvent.  Like the named events, the TypedEvents are
+        not fired while the window is muted, or while the named event they
+        go with is deferred via the EventQueue.
+    */
+    TypedEvent<MouseEventArgs>& getMouseMoveEvent()
+        { return d_mouseMoveEvent; }
+
+    //! Return the TypedEvent fired along with EventMouseWheel.
+    TypedEvent<MouseEventArgs>& getMouseWheelEvent()
+        { return d_mouseWheelEvent; }
+
+    //! Return the TypedEvent fired along with EventMouseButtonDown.
+    TypedEvent<MouseEventArgs>& getMouseButtonDownEvent()
+        { return d_mouseButtonDownEvent; }
+
+    //! Return the TypedEvent fired along with EventMouseButtonUp.
+    TypedEvent<MouseEventArgs>& getMouseButtonUpEvent()
+        { return d_mouseButtonUpEvent; }
+
     /*!
     \brief
         Writes an xml representation of this window object to \a out_stream.
@@ -1232,6 +1294,8 @@ protected:
     // friend classes for construction / initialisation purposes (for now)
     friend class System;
     friend class WindowManager;
+    friend class TimePulseScheduler;
+    friend class EventQueue;
 
     /*************************************************************************
         Event trigger methods
@@ -1304,6 +1368,25 @@ protected:
     */
     virtual void updateSelf(float elapsed);
 
+    /*!
+    \brief
+        Update this window alone: updateSelf, the RenderingWindow if any and
+        EventWindowUpdated, but not the child windows.
+    */
+    void update_impl(float elapsed);
+
+    /*!
+    \brief
+        Return whether this window needs to be updated on every time pulse
+        when scheduled time pulses are enabled.  The default returns true if
+        EventWindowUpdated has subscribers, the window is drawn via a
+        RenderingWindow, whose RenderEffect may be animated, or the window is
+        a Tooltip timing its display for a target window.  Derived classes
+        and windows with a WindowRenderer that need regular updates for other
+        reasons override this, or use scheduleUpdate.
+    */
+    virtual bool needsContinuousUpdate() const;
+
     /*!
     \brief
         Perform the actual rendering for this Window.
@@ -1396,6 +1479,20 @@ protected:
     //! Helper to intialise the needed clipping for geometry and render surface.
     void initialiseClippers(const RenderingContext& ctx);
 
+    /*!
+    \brief
+        helper to fire the TypedEvent \a ev that goes with the event \a name,
+        under the same rules as fireEvent: nothing is fired while the window
+        is muted, nor while \a name is deferred via the EventQueue, whose
+        deferred firing can not pass on \a args.
+    */
+    void fireTypedEvent(TypedEvent<MouseEventArgs>& ev, const EventID& name,
+                        MouseEventArgs& args);
+
+    //! helper to point \a tip at \a target, keeping \a tip updated for as
+    //! long as it has a target whose hover and display times it counts.
+    static void setTooltipTarget(Tooltip& tip, Window* target);
+
 	//virtual
     virtual void cleanupChildren(void);
     virtual void addChild_impl(Window* wnd);
@@ -1620,6 +1717,8 @@ protected:
     RenderingSurface* d_surface;
     //! true if window geometry cache needs to be regenerated.
     mutable bool d_needsRedraw;
+    //! why d_needsRedraw was set; reported by the RenderProfiler.
+    RenderProfiler::RedrawReason d_redrawReason;
     //! holds setting for automatic creation of of surface (RenderingWindow)
     bool d_autoRenderingWindow;
 
@@ -1706,6 +1805,8 @@ protected:
     bool d_weOwnTip;
     //! whether tooltip text may be inherited from parent.
     bool d_inheritsTipText;
+    //! true while this window is a Tooltip with a target window.
+    bool d_tooltipTimerActive;
 
     //! true if this window is allowed to write XML, false if not
     bool d_allowWriteXML;
@@ -1749,6 +1850,12 @@ protected:
     //! specifies whether mouse inputs should be propagated to parent(s)
     bool d_propagateMouseInputs;
 
+    //! typed counterparts of the hottest mouse events.
+    TypedEvent<MouseEventArgs> d_mouseMoveEvent;
+    TypedEvent<MouseEventArgs> d_mouseWheelEvent;
+    TypedEvent<MouseEventArgs> d_mouseButtonDownEvent;
+    TypedEvent<MouseEventArgs> d_mouseButtonUpEvent;
+
 
 private:
     /*************************************************************************
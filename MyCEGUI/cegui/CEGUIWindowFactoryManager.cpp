@@ -46,13 +46,13 @@ void WindowFactoryManager::addFactory(WindowFactory* factory)
 	}
 
 	// throw exception if type name for factory is already in use
-	if (d_factoryRegistry.find(factory->getTypeName()) != d_factoryRegistry.end())
+	if (d_factoryRegistry.find(InternedString::find(factory->getTypeName())) != d_factoryRegistry.end())
 	{
 		CEGUI_THROW(AlreadyExistsException("WindowFactoryManager::addFactory - A WindowFactory for type '" + factory->getTypeName() + "' is already registered."));
 	}
 
 	// add the factory to the registry
-	d_factoryRegistry[factory->getTypeName()] = factory;
+	d_factoryRegistry[InternedString(factory->getTypeName())] = factory;
 
     char addr_buff[32];
     sprintf(addr_buff, "(%p)", static_cast<void*>(factory));
@@ -66,7 +66,7 @@ void WindowFactoryManager::addFactory(WindowFactory* factory)
 *************************************************************************/
 void WindowFactoryManager::removeFactory(const String& name)
 {
-    WindowFactoryRegistry::iterator i = d_factoryRegistry.find(name);
+    WindowFactoryRegistry::iterator i = d_factoryRegistry.find(InternedString::find(name));
 
     // exit if no factory exists for this type
     if (i == d_factoryRegistry.end())
@@ -80,7 +80,7 @@ void WindowFactoryManager::removeFactory(const String& name)
     char addr_buff[32];
     sprintf(addr_buff, "(%p)", static_cast<void*>((*i).second));
 
-	d_factoryRegistry.erase(name);
+	d_factoryRegistry.erase(i);
 
     Logger::getSingleton().logEvent("WindowFactory for '" + name +
                                     "' windows removed. " + addr_buff);
@@ -127,7 +127,7 @@ WindowFactory* WindowFactoryManager::getFactory(const String& type) const
     String targetType(getDereferencedAliasType(type));
 
 	// try for a 'real' type
-	WindowFactoryRegistry::const_iterator pos = d_factoryRegistry.find(targetType);
+	WindowFactoryRegistry::const_iterator pos = d_factoryRegistry.find(InternedString::find(targetType));
 
 	// found an actual factory for this type
 	if (pos != d_factoryRegistry.end())
@@ -137,7 +137,7 @@ WindowFactory* WindowFactoryManager::getFactory(const String& type) const
     // no concrete type, try for a falagard mapped type
     else
     {
-        FalagardMapRegistry::const_iterator falagard = d_falagardRegistry.find(targetType);
+        FalagardMapRegistry::const_iterator falagard = d_falagardRegistry.find(InternedString::find(targetType));
 
         // found falagard mapping for this type
         if (falagard != d_falagardRegistry.end())
@@ -164,14 +164,14 @@ bool WindowFactoryManager::isFactoryPresent(const String& name) const
     String targetType(getDereferencedAliasType(name));
 
     // now try for a 'real' type
-    if (d_factoryRegistry.find(targetType) != d_factoryRegistry.end())
+    if (d_factoryRegistry.find(InternedString::find(targetType)) != d_factoryRegistry.end())
     {
         return true;
     }
     // not a concrete type, so return whether it's a Falagard mapped type.
     else
     {
-        return (d_falagardRegistry.find(targetType) != d_falagardRegistry.end());
+        return (d_falagardRegistry.find(InternedString::find(targetType)) != d_falagardRegistry.end());
     }
 }
 
@@ -201,11 +201,11 @@ WindowFactoryManager::TypeAliasIterator WindowFactoryManager::getAliasIterator(v
 *************************************************************************/
 void WindowFactoryManager::addWindowTypeAlias(const String& aliasName, const String& targetType)
 {
-	TypeAliasRegistry::iterator pos = d_aliasRegistry.find(aliasName);
+	TypeAliasRegistry::iterator pos = d_aliasRegistry.find(InternedString::find(aliasName));
 
 	if (pos == d_aliasRegistry.end())
 	{
-		d_aliasRegistry[aliasName].d_targetStack.push_back(targetType);
+		d_aliasRegistry[InternedString(aliasName)].d_targetStack.push_back(targetType);
 	}
 	// alias already exists, add our new entry to the list already there
 	else
@@ -223,7 +223,7 @@ void WindowFactoryManager::addWindowTypeAlias(const String& aliasName, const Str
 void WindowFactoryManager::removeWindowTypeAlias(const String& aliasName, const String& targetType)
 {
 	// find alias name
-	TypeAliasRegistry::iterator pos = d_aliasRegistry.find(aliasName);
+	TypeAliasRegistry::iterator pos = d_aliasRegistry.find(InternedString::find(aliasName));
 
 	// if alias name exists
 	if (pos != d_aliasRegistry.end())
@@ -243,7 +243,7 @@ void WindowFactoryManager::removeWindowTypeAlias(const String& aliasName, const
 			if (pos->second.d_targetStack.empty())
 			{
 				// erase the alias name also
-				d_aliasRegistry.erase(aliasName);
+				d_aliasRegistry.erase(pos);
 
 				Logger::getSingleton().logEvent("Window type alias named '" + aliasName + "' has no more targets and has been removed.", Informative);
 			}
@@ -268,7 +268,7 @@ void WindowFactoryManager::addFalagardWindowMapping(const String& newType,
     mapping.d_effectName = effectName;
 
     // see if the type we're creating already exists
-    if (d_falagardRegistry.find(newType) != d_falagardRegistry.end())
+    if (d_falagardRegistry.find(InternedString::find(newType)) != d_falagardRegistry.end())
     {
         // type already exists, log the fact that it's going to be replaced.
         Logger::getSingleton().logEvent("Falagard mapping for type '" + newType + "' already exists - current mapping will be replaced.");
@@ -281,12 +281,12 @@ void WindowFactoryManager::addFalagardWindowMapping(const String& newType,
         renderer + "' Look'N'Feel '" + lookName + "' and RenderEffect '" +
         effectName + "'. " + addr_buff);
 
-    d_falagardRegistry[newType] = mapping;
+    d_falagardRegistry[InternedString(newType)] = mapping;
 }
 
 void WindowFactoryManager::removeFalagardWindowMapping(const String& type)
 {
-    FalagardMapRegistry::iterator iter = d_falagardRegistry.find(type);
+    FalagardMapRegistry::iterator iter = d_falagardRegistry.find(InternedString::find(type));
 
     if (iter != d_falagardRegistry.end())
     {
@@ -302,13 +302,13 @@ WindowFactoryManager::FalagardMappingIterator WindowFactoryManager::getFalagardM
 
 bool WindowFactoryManager::isFalagardMappedType(const String& type) const
 {
-    return d_falagardRegistry.find(getDereferencedAliasType(type)) != d_falagardRegistry.end();
+    return d_falagardRegistry.find(InternedString::find(getDereferencedAliasType(type))) != d_falagardRegistry.end();
 }
 
 const String& WindowFactoryManager::getMappedLookForType(const String& type) const
 {
     FalagardMapRegistry::const_iterator iter =
-        d_falagardRegistry.find(getDereferencedAliasType(type));
+        d_falagardRegistry.find(InternedString::find(getDereferencedAliasType(type)));
 
     if (iter != d_falagardRegistry.end())
     {
@@ -324,7 +324,7 @@ const String& WindowFactoryManager::getMappedLookForType(const String& type) con
 const String& WindowFactoryManager::getMappedRendererForType(const String& type) const
 {
     FalagardMapRegistry::const_iterator iter =
-        d_falagardRegistry.find(getDereferencedAliasType(type));
+        d_falagardRegistry.find(InternedString::find(getDereferencedAliasType(type)));
 
     if (iter != d_falagardRegistry.end())
     {
@@ -339,7 +339,7 @@ const String& WindowFactoryManager::getMappedRendererForType(const String& type)
 
 String WindowFactoryManager::getDereferencedAliasType(const String& type) const
 {
-    TypeAliasRegistry::const_iterator alias = d_aliasRegistry.find(type);
+    TypeAliasRegistry::const_iterator alias = d_aliasRegistry.find(InternedString::find(type));
 
     // if this is an aliased type, ensure to fully dereference by recursively
     // calling ourselves on the active target for the given type.
@@ -353,7 +353,7 @@ String WindowFactoryManager::getDereferencedAliasType(const String& type) const
 const WindowFactoryManager::FalagardWindowMapping& WindowFactoryManager::getFalagardMappingForType(const String& type) const
 {
     FalagardMapRegistry::const_iterator iter =
-        d_falagardRegistry.find(getDereferencedAliasType(type));
+        d_falagardRegistry.find(InternedString::find(getDereferencedAliasType(type)));
 
     if (iter != d_falagardRegistry.end())
     {
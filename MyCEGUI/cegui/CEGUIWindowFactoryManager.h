@@ -2,6 +2,7 @@
 
 #include "CEGUIBase.h"
 #include "CEGUIString.h"
+#include "CEGUIInternedStringMap.h"
 #include "CEGUISingleton.h"
 #include "CEGUILogger.h"
 #include "CEGUIIteratorBase.h"
@@ -132,9 +133,9 @@ private:
 	/*************************************************************************
 		Implementation Data
 	*************************************************************************/
-	typedef	std::map<String, WindowFactory*, String::FastLessCompare>	WindowFactoryRegistry;		//!< Type used to implement registry of WindowFactory objects
-	typedef std::map<String, AliasTargetStack, String::FastLessCompare>	TypeAliasRegistry;		//!< Type used to implement registry of window type aliases.
-    typedef std::map<String, FalagardWindowMapping, String::FastLessCompare> FalagardMapRegistry;    //!< Type used to implement registry of falagard window mappings.
+	typedef	InternedStringMap<WindowFactory*>	WindowFactoryRegistry;		//!< Type used to implement registry of WindowFactory objects
+	typedef InternedStringMap<AliasTargetStack>	TypeAliasRegistry;		//!< Type used to implement registry of window type aliases.
+    typedef InternedStringMap<FalagardWindowMapping> FalagardMapRegistry;    //!< Type used to implement registry of falagard window mappings.
     //! Type used for list of WindowFacory objects that we created ourselves
     typedef std::vector<WindowFactory*> OwnedWindowFactoryList;
 
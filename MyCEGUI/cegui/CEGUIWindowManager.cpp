@@ -101,7 +101,7 @@ Window* WindowManager::createWindow(const String& type, const String& name)
         initialiseRenderEffect(newWindow, fwm.d_effectName);
     }
 
-	d_windowRegistry[finalName] = newWindow;
+	d_windowRegistry[InternedString(finalName)] = newWindow;
 
     // fire event to notify interested parites about the new window.
     WindowEventArgs args(newWindow);
@@ -183,7 +183,7 @@ void WindowManager::destroyWindow(Window* window)
 *************************************************************************/
 void WindowManager::destroyWindow(const String& window)
 {
-	WindowRegistry::iterator wndpos = d_windowRegistry.find(window);
+	WindowRegistry::iterator wndpos = d_windowRegistry.find(InternedString::find(window));
 
 	if (wndpos != d_windowRegistry.end())
 	{
@@ -218,13 +218,13 @@ void WindowManager::destroyWindow(const String& window)
 /*************************************************************************
 	Return a pointer to the named window
 *************************************************************************/
-Window* WindowManager::getWindow(const String& name) const
+Window* WindowManager::getWindow(const StringView& name) const
 {
-	WindowRegistry::const_iterator pos = d_windowRegistry.find(name);
+	WindowRegistry::const_iterator pos = d_windowRegistry.find(InternedString::find(name));
 
 	if (pos == d_windowRegistry.end())
 	{
-		CEGUI_THROW(UnknownObjectException("WindowManager::getWindow - A Window object with the name '" + name +"' does not exist within the system"));
+		CEGUI_THROW(UnknownObjectException("WindowManager::getWindow - A Window object with the name '" + name.str() +"' does not exist within the system"));
 	}
 
 	return pos->second;
@@ -234,9 +234,20 @@ Window* WindowManager::getWindow(const String& name) const
 /*************************************************************************
 	Return true if a window with the given name is present
 *************************************************************************/
-bool WindowManager::isWindowPresent(const String& name) const
+bool WindowManager::isWindowPresent(const StringView& name) const
 {
-	return (d_windowRegistry.find(name) != d_windowRegistry.end());
+	return (d_windowRegistry.find(InternedString::find(name)) != d_windowRegistry.end());
+}
+
+
+/*************************************************************************
+	Return a pointer to the named window, or 0 if it does not exist
+*************************************************************************/
+Window* WindowManager::findWindow(const StringView& name) const
+{
+	WindowRegistry::const_iterator pos = d_windowRegistry.find(InternedString::find(name));
+
+	return (pos == d_windowRegistry.end()) ? 0 : pos->second;
 }
 
 
@@ -362,7 +373,7 @@ void WindowManager::renameWindow(Window* window, const String& new_name)
 {
     if (window)
     {
-        WindowRegistry::iterator pos = d_windowRegistry.find(window->getName());
+        WindowRegistry::iterator pos = d_windowRegistry.find(InternedString::find(window->getName()));
 
         if (pos != d_windowRegistry.end())
         {
@@ -378,13 +389,13 @@ void WindowManager::renameWindow(Window* window, const String& new_name)
             CEGUI_CATCH (AlreadyExistsException&)
             {
                 // re-add window to registry under it's old name
-                d_windowRegistry[window->getName()] = window;
+                d_windowRegistry[InternedString(window->getName())] = window;
                 // rethrow exception.
                 CEGUI_RETHROW;
             }
 
             // add window to registry under new name
-            d_windowRegistry[new_name] = window;
+            d_windowRegistry[InternedString(new_name)] = window;
         }
     }
 }
@@ -2,6 +2,8 @@
 
 #include "CEGUIBase.h"
 #include "CEGUIString.h"
+#include "CEGUIInternedStringMap.h"
+#include "CEGUIStringView.h"
 #include "CEGUISingleton.h"
 #include "CEGUILogger.h"
 #include "CEGUIIteratorBase.h"
@@ -75,8 +77,10 @@ public:
 	//exception	InvalidRequestException		Can be thrown if the WindowFactory for \a window's object type was removed.
 	void	destroyWindow(const String& window);
 	//exception UnknownObjectException	No Window object with a name matching \a name was found.
-	Window*	getWindow(const String& name) const;
-	bool	isWindowPresent(const String& name) const;
+	Window*	getWindow(const StringView& name) const;
+	bool	isWindowPresent(const StringView& name) const;
+	//! Return the Window named \a name, or 0 if there is no such Window.
+	Window*	findWindow(const StringView& name) const;
 	//exception	InvalidRequestException		Thrown if the WindowFactory for any Window object type has been removed.
 	void	destroyAllWindows(void);
 
@@ -240,7 +244,7 @@ private:
 	/*************************************************************************
 		Implementation Data
 	*************************************************************************/
-	typedef std::map<String, Window*, String::FastLessCompare>			WindowRegistry;				//!< Type used to implement registry of Window objects
+	typedef InternedStringMap<Window*>			WindowRegistry;				//!< Type used to implement registry of Window objects
     typedef std::vector<Window*>    WindowVector;   //!< Type to use for a collection of Window pointers.
 
 	WindowRegistry			d_windowRegistry;			//!< The container that forms the Window registry
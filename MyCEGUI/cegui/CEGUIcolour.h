@@ -245,6 +245,9 @@ private:
 	float d_alpha, d_red, d_green, d_blue;		//!< Colour components.
 	mutable argb_t d_argb;						//!< Colour as ARGB value.
 	mutable bool d_argbValid;					//!< True if argb value is valid.
+
+	// packs colours straight from the components, several at a time.
+	friend class VertexConversion;
 };
 
 }
\ No newline at end of file
@@ -31,6 +31,7 @@
 #include "CEGUIRenderEffect.h"
 #include "CEGUIVertex.h"
 #include <d3d9.h>
+#include <cstring>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -40,13 +41,9 @@ Direct3D9GeometryBuffer::Direct3D9GeometryBuffer(Direct3D9Renderer& owner,
                                                  LPDIRECT3DDEVICE9 device) :
     d_owner(owner),
     d_activeTexture(0),
-    d_clipRect(0, 0, 0, 0),
-    d_translation(0, 0, 0),
-    d_rotation(0, 0, 0),
-    d_pivot(0, 0, 0),
-    d_effect(0),
     d_device(device),
-    d_matrixValid(false)
+    d_matrixValid(false),
+    d_uploadedCount(0)
 {
 }
 
@@ -69,6 +66,12 @@ void Direct3D9GeometryBuffer::draw() const
 
     d_owner.setupRenderingBlendMode(d_blendMode);
 
+    // draw from the static vertex buffer where possible.
+    const bool retained = uploadVertices();
+    if (retained)
+        d_device->SetStreamSource(0, d_owner.getVertexBuffer(), 0,
+                                  sizeof(D3DVertex));
+
     const int pass_count = d_effect ? d_effect->getPassCount() : 1;
     for (int pass = 0; pass < pass_count; ++pass)
     {
@@ -82,8 +85,15 @@ void Direct3D9GeometryBuffer::draw() const
         for ( ; i != d_batches.end(); ++i)
         {
             d_device->SetTexture(0, (*i).first);
-            d_device->DrawPrimitiveUP(D3DPT_TRIANGLELIST, (*i).second / 3,
-                                    &d_vertices[pos], sizeof(D3DVertex));
+
+            if (retained)
+                d_device->DrawPrimitive(D3DPT_TRIANGLELIST,
+                                        d_vertexAllocation.d_offset + pos,
+                                        (*i).second / 3);
+            else
+                d_device->DrawPrimitiveUP(D3DPT_TRIANGLELIST,
+                                          (*i).second / 3,
+                                          &d_vertices[pos], sizeof(D3DVertex));
             pos += (*i).second;
         }
     }
@@ -133,25 +143,66 @@ void Direct3D9GeometryBuffer::appendVertex(const Vertex& vertex)
 void Direct3D9GeometryBuffer::appendGeometry(const Vertex* const vbuff,
                                              uint vertex_count)
 {
+    if (!vertex_count)
+        return;
+
+    performBatchManagement();
+
+    // update size of current batch
+    d_batches.back().second += vertex_count;
+
+    // grow the buffer once, then convert straight into the new space from
+    // CEGUI::Vertex to something directly usable by D3D as needed.
+    const size_t first = d_vertices.size();
+    d_vertices.resize(first + vertex_count);
+    VertexConversion::convert(vbuff, &d_vertices[first], vertex_count, -0.5f);
+}
+
+//----------------------------------------------------------------------------//
+void Direct3D9GeometryBuffer::appendQuads(const GeometryQuad* const quads,
+                                          uint quad_count)
+{
+    if (!quad_count)
+        return;
+
     performBatchManagement();
 
+    const uint vertex_count = quad_count * 6;
+
     // update size of current batch
     d_batches.back().second += vertex_count;
 
-    // buffer these vertices
-    D3DVertex vd;
-    const Vertex* vs = vbuff;
-    for (uint i = 0; i < vertex_count; ++i, ++vs)
+    // grow the buffer once, then generate the vertices in place.
+    const size_t first = d_vertices.size();
+    d_vertices.resize(first + vertex_count);
+
+    D3DVertex* vd = &d_vertices[first];
+    const GeometryQuad* q = quads;
+    for (uint i = 0; i < quad_count; ++i, ++q)
     {
-        // copy vertex info the buffer, converting from CEGUI::Vertex to
-        // something directly usable by D3D as needed.
-        vd.x       = vs->position.d_x - 0.5f;
-        vd.y       = vs->position.d_y - 0.5f;
-        vd.z       = vs->position.d_z;
-        vd.diffuse = vs->colour_val.getARGB();
-        vd.tu      = vs->tex_coords.d_x;
-        vd.tv      = vs->tex_coords.d_y;
-        d_vertices.push_back(vd);
+        const float left   = q->position.d_left - 0.5f;
+        const float top    = q->position.d_top - 0.5f;
+        const float right  = q->position.d_right - 0.5f;
+        const float bottom = q->position.d_bottom - 0.5f;
+
+        // the four distinct vertices, in QuadCorner order.
+        const D3DVertex corners[4] =
+        {
+            { left, top, q->z, q->top_left,
+              q->tex_coords.d_left, q->tex_coords.d_top },
+            { right, top, q->z, q->top_right,
+              q->tex_coords.d_right, q->tex_coords.d_top },
+            { left, bottom, q->z, q->bottom_left,
+              q->tex_coords.d_left, q->tex_coords.d_bottom },
+            { right, bottom, q->z, q->bottom_right,
+              q->tex_coords.d_right, q->tex_coords.d_bottom }
+        };
+
+        const int* const order =
+            s_quadCorners[q->split_mode == TopLeftToBottomRight ? 0 : 1];
+
+        for (int v = 0; v < 6; ++v)
+            *vd++ = corners[order[v]];
     }
 }
 
@@ -167,6 +218,8 @@ void Direct3D9GeometryBuffer::reset()
     d_batches.clear();
     d_vertices.clear();
     d_activeTexture = 0;
+    // keep our space in the static vertex buffer, but refill it.
+    d_uploadedCount = 0;
 }
 
 //----------------------------------------------------------------------------//
@@ -199,6 +252,50 @@ RenderEffect* Direct3D9GeometryBuffer::getRenderEffect()
     return d_effect;
 }
 
+//----------------------------------------------------------------------------//
+bool Direct3D9GeometryBuffer::isMergeableWith(
+    const GeometryBuffer& buffer) const
+{
+    const Direct3D9GeometryBuffer& other =
+        static_cast<const Direct3D9GeometryBuffer&>(buffer);
+
+    // merging is only worthwhile if it joins batches using the same texture.
+    return isMergeCompatibleWith(other) &&
+           d_batches.back().first == other.d_batches.front().first;
+}
+
+//----------------------------------------------------------------------------//
+void Direct3D9GeometryBuffer::appendMergedGeometry(const GeometryBuffer& buffer)
+{
+    const Direct3D9GeometryBuffer& other =
+        static_cast<const Direct3D9GeometryBuffer&>(buffer);
+
+    mergeStateOf(other);
+
+    // the vertices were stored with the -0.5 pixel to texel offset applied.
+    const Rect clip(other.d_clipRect.d_left - 0.5f,
+                    other.d_clipRect.d_top - 0.5f,
+                    other.d_clipRect.d_right - 0.5f,
+                    other.d_clipRect.d_bottom - 0.5f);
+
+    size_t pos = 0;
+    BatchList::const_iterator i = other.d_batches.begin();
+    for ( ; i != other.d_batches.end(); ++i)
+    {
+        if (d_batches.empty() || (d_batches.back().first != (*i).first))
+            d_batches.push_back(BatchInfo((*i).first, 0));
+
+        d_batches.back().second += VertexConversion::appendClippedTriangles(
+            &other.d_vertices[pos], (*i).second,
+            other.d_translation.d_x, other.d_translation.d_y, clip, d_vertices);
+        pos += (*i).second;
+
+        // drop the batch again if everything in it was clipped away.
+        if (!d_batches.back().second)
+            d_batches.pop_back();
+    }
+}
+
 //----------------------------------------------------------------------------//
 void Direct3D9GeometryBuffer::performBatchManagement()
 {
@@ -228,6 +325,56 @@ void Direct3D9GeometryBuffer::updateMatrix() const
     d_matrixValid = true;
 }
 
+//----------------------------------------------------------------------------//
+bool Direct3D9GeometryBuffer::uploadVertices() const
+{
+    const LPDIRECT3DVERTEXBUFFER9 vb = d_owner.getVertexBuffer();
+    const uint count = d_vertices.size();
+
+    if (!vb || !count)
+        return false;
+
+    VertexPool& pool = d_owner.getVertexPool();
+
+    // get new space if ours was handed to another buffer, or is too small.
+    // Some spare room is reserved so that appending to the buffer does not
+    // immediately need another move.
+    if (!pool.isValid(d_vertexAllocation) ||
+        d_vertexAllocation.d_capacity < count)
+    {
+        if (!pool.allocate(count + count / 2, d_vertexAllocation) &&
+            !pool.allocate(count, d_vertexAllocation))
+            return false;
+
+        d_uploadedCount = 0;
+    }
+
+    // copy only what was added since the last upload.
+    if (d_uploadedCount < count)
+    {
+        const uint first = d_uploadedCount;
+        const uint upload_count = count - first;
+        void* data;
+
+        if (FAILED(vb->Lock(
+                (d_vertexAllocation.d_offset + first) * sizeof(D3DVertex),
+                upload_count * sizeof(D3DVertex), &data, 0)))
+            return false;
+
+        std::memcpy(data, &d_vertices[first],
+                    upload_count * sizeof(D3DVertex));
+        vb->Unlock();
+
+        pool.recordUpload(upload_count);
+        pool.recordReuse(first);
+        d_uploadedCount = count;
+    }
+    else
+        pool.recordReuse(count);
+
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 const D3DXMATRIX* Direct3D9GeometryBuffer::getMatrix() const
 {
@@ -31,6 +31,7 @@
 #include "../../CEGUIGeometryBuffer.h"
 #include "CEGUIDirect3D9Renderer.h"
 #include "../../CEGUIRect.h"
+#include "../../CEGUIVertexConversion.h"
 #include <d3dx9.h>
 #include <utility>
 #include <vector>
@@ -66,6 +67,7 @@ public:
     void setClippingRegion(const Rect& region);
     void appendVertex(const Vertex& vertex);
     void appendGeometry(const Vertex* const vbuff, uint vertex_count);
+    void appendQuads(const GeometryQuad* const quads, uint quad_count);
     void setActiveTexture(Texture* texture);
     void reset();
     Texture* getActiveTexture() const;
@@ -74,22 +76,28 @@ public:
     void setRenderEffect(RenderEffect* effect);
     RenderEffect* getRenderEffect();
 
+    // overrides of virtual members from GeometryBuffer
+    bool isMergeableWith(const GeometryBuffer& buffer) const;
+    void appendMergedGeometry(const GeometryBuffer& buffer);
+
 protected:
     //! perform batch management operations prior to adding new geometry.
     void performBatchManagement();
     //! update cached matrix
     void updateMatrix() const;
+    /*!
+    \brief
+        make sure the renderer's static vertex buffer holds all of our
+        vertices, copying only those added since the last upload.
+
+    \return
+        - true if the vertices may be drawn from the static vertex buffer.
+        - false if they have to be passed to the device with the draw call.
+    */
+    bool uploadVertices() const;
 
     //! internal Vertex structure used for Direct3D based geometry.
-    struct D3DVertex
-    {
-        //! The transformed position for the vertex.
-        FLOAT x, y, z;
-        //! colour of the vertex.
-        DWORD diffuse;
-        //! texture coordinates.
-        float tu, tv;
-    };
+    typedef PackedVertex D3DVertex;
 
     //! Owning Direct3D9Renderer object
     Direct3D9Renderer& d_owner;
@@ -105,22 +113,16 @@ protected:
     typedef std::vector<D3DVertex> VertexList;
     //! container where added geometry is stored.
     VertexList d_vertices;
-    //! rectangular clip region
-    Rect d_clipRect;
-    //! translation vector
-    Vector3 d_translation;
-    //! rotation vector
-    Vector3 d_rotation;
-    //! pivot point for rotation
-    Vector3 d_pivot;
-    //! RenderEffect that will be used by the GeometryBuffer
-    RenderEffect* d_effect;
     //! The D3D Device
     LPDIRECT3DDEVICE9 d_device;
     //! model matrix cache
     mutable D3DXMATRIX d_matrix;
     //! true when d_matrix is valid and up to date
     mutable bool d_matrixValid;
+    //! space in the renderer's static vertex buffer holding our vertices.
+    mutable VertexPool::Allocation d_vertexAllocation;
+    //! number of vertices from d_vertices that are in the static buffer.
+    mutable uint d_uploadedCount;
 };
 
 } // End of  CEGUI namespace section
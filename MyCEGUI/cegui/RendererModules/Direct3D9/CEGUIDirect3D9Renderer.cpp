@@ -56,6 +56,10 @@ static const D3DMATRIX s_identityMatrix =
     0.0, 0.0, 0.0, 1.0
 };
 
+//----------------------------------------------------------------------------//
+// number of vertices in the static vertex buffer shared by geometry buffers.
+static const uint s_vertexPoolSize = 128 * 1024;
+
 //----------------------------------------------------------------------------//
 Direct3D9Renderer& Direct3D9Renderer::bootstrapSystem(LPDIRECT3DDEVICE9 device)
 {
@@ -215,6 +219,8 @@ void Direct3D9Renderer::destroyAllTextures()
 //----------------------------------------------------------------------------//
 void Direct3D9Renderer::beginRendering()
 {
+    d_vertexPool.resetFrameCounters();
+
     d_device->SetFVF(D3DFVF_XYZ | D3DFVF_DIFFUSE | D3DFVF_TEX1);
 
     // no shaders initially
@@ -311,7 +317,9 @@ Direct3D9Renderer::Direct3D9Renderer(LPDIRECT3DDEVICE9 device) :
     d_displaySize(getViewportSize()),
     d_displayDPI(96, 96),
     d_defaultRoot(0),
-    d_defaultTarget(0)
+    d_defaultTarget(0),
+    d_vertexBuffer(0),
+    d_vertexPool(s_vertexPoolSize)
 {
     D3DCAPS9 caps;
     device->GetDeviceCaps(&caps);
@@ -328,6 +336,15 @@ Direct3D9Renderer::Direct3D9Renderer(LPDIRECT3DDEVICE9 device) :
     d_supportNPOTTex = !(caps.TextureCaps & D3DPTEXTURECAPS_POW2) ||
                        (caps.TextureCaps & D3DPTEXTURECAPS_NONPOW2CONDITIONAL);
 
+    // a managed buffer survives device resets, so retained geometry does not
+    // have to be re-uploaded after one.  If it can not be created, geometry
+    // buffers fall back to passing their vertices with every draw.
+    if (FAILED(d_device->CreateVertexBuffer(
+            s_vertexPoolSize * sizeof(PackedVertex), D3DUSAGE_WRITEONLY,
+            D3DFVF_XYZ | D3DFVF_DIFFUSE | D3DFVF_TEX1, D3DPOOL_MANAGED,
+            &d_vertexBuffer, 0)))
+        d_vertexBuffer = 0;
+
     d_defaultTarget = new Direct3D9ViewportTarget(*this);
     d_defaultRoot = new RenderingRoot(*d_defaultTarget);
 }
@@ -341,6 +358,9 @@ Direct3D9Renderer::~Direct3D9Renderer()
 
     delete d_defaultRoot;
     delete d_defaultTarget;
+
+    if (d_vertexBuffer)
+        d_vertexBuffer->Release();
 }
 
 //----------------------------------------------------------------------------//
@@ -394,6 +414,18 @@ LPDIRECT3DDEVICE9 Direct3D9Renderer::getDevice() const
     return d_device;
 }
 
+//----------------------------------------------------------------------------//
+LPDIRECT3DVERTEXBUFFER9 Direct3D9Renderer::getVertexBuffer() const
+{
+    return d_vertexBuffer;
+}
+
+//----------------------------------------------------------------------------//
+VertexPool& Direct3D9Renderer::getVertexPool()
+{
+    return d_vertexPool;
+}
+
 //----------------------------------------------------------------------------//
 Texture& Direct3D9Renderer::createTexture(LPDIRECT3DTEXTURE9 texture)
 {
@@ -4,6 +4,7 @@
 #include "../../CEGUIRenderer.h"
 #include "../../CEGUISize.h"
 #include "../../CEGUIVector.h"
+#include "../../CEGUIVertexPool.h"
 
 #include <d3d9.h>
 #include <vector>
@@ -96,6 +97,16 @@ public:
     void setupRenderingBlendMode(const BlendMode mode,
                                  const bool force = false);
 
+    /*!
+    \brief
+        return the static vertex buffer that geometry buffers keep their
+        vertices in between frames, or 0 if it could not be created.
+    */
+    LPDIRECT3DVERTEXBUFFER9 getVertexBuffer() const;
+
+    //! return the VertexPool that manages space in the static vertex buffer.
+    VertexPool& getVertexPool();
+
     // implement Renderer interface
     RenderingRoot& getDefaultRenderingRoot();
     GeometryBuffer& createGeometryBuffer();
@@ -161,6 +172,10 @@ private:
     bool d_supportNonSquareTex;
     //! What we think is the active blendine mode
     BlendMode d_activeBlendMode;
+    //! static vertex buffer shared by all geometry buffers.
+    LPDIRECT3DVERTEXBUFFER9 d_vertexBuffer;
+    //! allocator for space in d_vertexBuffer.
+    VertexPool d_vertexPool;
   };
 
 }
@@ -0,0 +1,183 @@
+#include "CEGUINullGeometryBuffer.h"
+#include "CEGUIRenderEffect.h"
+#include "CEGUIVertex.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+NullGeometryBuffer::NullGeometryBuffer(NullRenderer& owner) :
+    d_owner(owner),
+    d_activeTexture(0),
+    d_vertexCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::draw() const
+{
+    // a real renderer sets the scissor region once per buffer.
+    d_owner.recordGeometryBufferDraw(d_clipRect);
+
+    const int pass_count = d_effect ? d_effect->getPassCount() : 1;
+    for (int pass = 0; pass < pass_count; ++pass)
+    {
+        // set up RenderEffect
+        if (d_effect)
+            d_effect->performPreRenderFunctions(pass);
+
+        // 'draw' the batches
+        BatchList::const_iterator i = d_batches.begin();
+        for ( ; i != d_batches.end(); ++i)
+            d_owner.recordBatchDraw((*i).first, (*i).second);
+    }
+
+    // clean up RenderEffect
+    if (d_effect)
+        d_effect->performPostRenderFunctions();
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::setTranslation(const Vector3& v)
+{
+    d_translation = v;
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::setRotation(const Vector3& r)
+{
+    d_rotation = r;
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::setPivot(const Vector3& p)
+{
+    d_pivot = p;
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::setClippingRegion(const Rect& region)
+{
+    d_clipRect.d_top    = ceguimax(0.0f, PixelAligned(region.d_top));
+    d_clipRect.d_bottom = ceguimax(0.0f, PixelAligned(region.d_bottom));
+    d_clipRect.d_left   = ceguimax(0.0f, PixelAligned(region.d_left));
+    d_clipRect.d_right  = ceguimax(0.0f, PixelAligned(region.d_right));
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::appendVertex(const Vertex& vertex)
+{
+    appendGeometry(&vertex, 1);
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::appendGeometry(const Vertex* const /*vbuff*/,
+                                        uint vertex_count)
+{
+    if (!vertex_count)
+        return;
+
+    performBatchManagement();
+
+    // update size of current batch
+    d_batches.back().second += vertex_count;
+    d_vertexCount += vertex_count;
+
+    d_owner.recordGeometryAppended(vertex_count);
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::appendQuads(const GeometryQuad* const /*quads*/,
+                                     uint quad_count)
+{
+    appendGeometry(0, quad_count * 6);
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::setActiveTexture(Texture* texture)
+{
+    d_activeTexture = texture;
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::reset()
+{
+    d_batches.clear();
+    d_vertexCount = 0;
+    d_activeTexture = 0;
+}
+
+//----------------------------------------------------------------------------//
+Texture* NullGeometryBuffer::getActiveTexture() const
+{
+    return d_activeTexture;
+}
+
+//----------------------------------------------------------------------------//
+uint NullGeometryBuffer::getVertexCount() const
+{
+    return d_vertexCount;
+}
+
+//----------------------------------------------------------------------------//
+uint NullGeometryBuffer::getBatchCount() const
+{
+    return d_batches.size();
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::setRenderEffect(RenderEffect* effect)
+{
+    d_effect = effect;
+}
+
+//----------------------------------------------------------------------------//
+RenderEffect* NullGeometryBuffer::getRenderEffect()
+{
+    return d_effect;
+}
+
+//----------------------------------------------------------------------------//
+bool NullGeometryBuffer::isMergeableWith(const GeometryBuffer& buffer) const
+{
+    const NullGeometryBuffer& other =
+        static_cast<const NullGeometryBuffer&>(buffer);
+
+    // same rules as the real renderers, so that the statistics match theirs.
+    return isMergeCompatibleWith(other) &&
+           d_batches.back().first == other.d_batches.front().first;
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::appendMergedGeometry(const GeometryBuffer& buffer)
+{
+    const NullGeometryBuffer& other =
+        static_cast<const NullGeometryBuffer&>(buffer);
+
+    mergeStateOf(other);
+
+    // there are no vertices to clip, so the batch sizes are simply added.
+    BatchList::const_iterator i = other.d_batches.begin();
+    for ( ; i != other.d_batches.end(); ++i)
+    {
+        if (d_batches.empty() || (d_batches.back().first != (*i).first))
+            d_batches.push_back(BatchInfo((*i).first, 0));
+
+        d_batches.back().second += (*i).second;
+    }
+
+    d_vertexCount += other.d_vertexCount;
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::performBatchManagement()
+{
+    // create a new batch if there are no batches yet, or if the active texture
+    // differs from that used by the current batch.
+    if (d_batches.empty() || (d_activeTexture != d_batches.back().first))
+        d_batches.push_back(BatchInfo(d_activeTexture, 0));
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
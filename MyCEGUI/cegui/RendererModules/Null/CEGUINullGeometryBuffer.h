@@ -0,0 +1,73 @@
+#pragma once
+
+#include "../../CEGUIGeometryBuffer.h"
+#include "CEGUINullRenderer.h"
+#include "../../CEGUIRect.h"
+
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    NullRenderer implementation of the GeometryBuffer interface.
+
+    Vertex data is never stored; the buffer keeps only the per-texture batch
+    sizes so that draw can report what a real renderer would have submitted.
+*/
+class NULL_GUIRENDERER_API NullGeometryBuffer : public GeometryBuffer
+{
+public:
+    //! Constructor
+    NullGeometryBuffer(NullRenderer& owner);
+
+    // implementation of abstract members from GeometryBuffer
+    void draw() const;
+    void setTranslation(const Vector3& t);
+    void setRotation(const Vector3& r);
+    void setPivot(const Vector3& p);
+    void setClippingRegion(const Rect& region);
+    void appendVertex(const Vertex& vertex);
+    void appendGeometry(const Vertex* const vbuff, uint vertex_count);
+    void appendQuads(const GeometryQuad* const quads, uint quad_count);
+    void setActiveTexture(Texture* texture);
+    void reset();
+    Texture* getActiveTexture() const;
+    uint getVertexCount() const;
+    uint getBatchCount() const;
+    void setRenderEffect(RenderEffect* effect);
+    RenderEffect* getRenderEffect();
+
+    // overrides of virtual members from GeometryBuffer
+    bool isMergeableWith(const GeometryBuffer& buffer) const;
+    void appendMergedGeometry(const GeometryBuffer& buffer);
+
+protected:
+    //! perform batch management operations prior to adding new geometry.
+    void performBatchManagement();
+
+    //! Owning NullRenderer object
+    NullRenderer& d_owner;
+    //! last texture that was set as active
+    Texture* d_activeTexture;
+    //! type to track info for per-texture sub batches of geometry
+    typedef std::pair<const Texture*, uint> BatchInfo;
+    //! type of container that tracks BatchInfos.
+    typedef std::vector<BatchInfo> BatchList;
+    //! list of texture batches added to the geometry buffer
+    BatchList d_batches;
+    //! total number of vertices added to the geometry buffer.
+    uint d_vertexCount;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
@@ -0,0 +1,69 @@
+#include "CEGUINullRenderTarget.h"
+#include "CEGUIRenderQueue.h"
+#include "CEGUIGeometryBuffer.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+NullRenderTarget::NullRenderTarget(NullRenderer& owner) :
+    d_owner(owner),
+    d_area(0, 0, 0, 0)
+{
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderTarget::draw(const GeometryBuffer& buffer)
+{
+    buffer.draw();
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderTarget::draw(const RenderQueue& queue)
+{
+    queue.draw();
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderTarget::setArea(const Rect& area)
+{
+    d_area = area;
+}
+
+//----------------------------------------------------------------------------//
+const Rect& NullRenderTarget::getArea() const
+{
+    return d_area;
+}
+
+//----------------------------------------------------------------------------//
+bool NullRenderTarget::isImageryCache() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderTarget::activate()
+{
+    d_owner.setActiveRenderTarget(this);
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderTarget::deactivate()
+{
+    if (d_owner.getActiveRenderTarget() == this)
+        d_owner.setActiveRenderTarget(0);
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderTarget::unprojectPoint(const GeometryBuffer& /*buff*/,
+                                      const Vector2& p_in,
+                                      Vector2& p_out) const
+{
+    // no transforms are ever applied, so there is nothing to undo.
+    p_out = p_in;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CEGUINullRenderer.h"
+#include "../../CEGUIRenderTarget.h"
+#include "../../CEGUIRect.h"
+
+namespace CEGUI
+{
+/*!
+\brief
+    NullRenderer implementation of a RenderTarget.
+
+    Used as-is for the renderer's default (viewport) target, and as the base
+    for NullTextureTarget.
+*/
+class NULL_GUIRENDERER_API NullRenderTarget : public virtual RenderTarget
+{
+public:
+    //! Constructor
+    NullRenderTarget(NullRenderer& owner);
+
+    // implement RenderTarget interface
+    void draw(const GeometryBuffer& buffer);
+    void draw(const RenderQueue& queue);
+    void setArea(const Rect& area);
+    const Rect& getArea() const;
+    bool isImageryCache() const;
+    void activate();
+    void deactivate();
+    void unprojectPoint(const GeometryBuffer& buff,
+                        const Vector2& p_in, Vector2& p_out) const;
+
+protected:
+    //! NullRenderer that created this object
+    NullRenderer& d_owner;
+    //! holds defined area for the RenderTarget
+    Rect d_area;
+};
+
+}
@@ -0,0 +1,313 @@
+#include "CEGUINullRenderer.h"
+#include "CEGUINullTexture.h"
+#include "CEGUINullGeometryBuffer.h"
+#include "CEGUINullRenderTarget.h"
+#include "CEGUINullTextureTarget.h"
+#include "CEGUIRenderingRoot.h"
+#include "CEGUIExceptions.h"
+#include "CEGUISystem.h"
+#include "CEGUIDefaultResourceProvider.h"
+
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+String NullRenderer::d_rendererID(
+"CEGUI::NullRenderer - renderer module that counts, but does not draw, "
+"geometry.");
+
+//----------------------------------------------------------------------------//
+// texture size we claim to support; nothing is ever allocated.
+static const uint s_maxTextureSize = 8192;
+
+//----------------------------------------------------------------------------//
+NullRenderer& NullRenderer::bootstrapSystem(const Size& display_size)
+{
+    if (System::getSingletonPtr())
+        CEGUI_THROW(InvalidRequestException(
+            "NullRenderer::bootstrapSystem: CEGUI::System object is "
+            "already initialised."));
+
+    NullRenderer& renderer(create(display_size));
+    DefaultResourceProvider* rp = new CEGUI::DefaultResourceProvider();
+    System::create(renderer, rp);
+
+    return renderer;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::destroySystem()
+{
+    System* sys;
+    if (!(sys = System::getSingletonPtr()))
+        CEGUI_THROW(InvalidRequestException("NullRenderer::destroySystem: "
+            "CEGUI::System object is not created or was already destroyed."));
+
+    NullRenderer* renderer = static_cast<NullRenderer*>(sys->getRenderer());
+    DefaultResourceProvider* rp =
+        static_cast<DefaultResourceProvider*>(sys->getResourceProvider());
+
+    System::destroy();
+    delete rp;
+    destroy(*renderer);
+}
+
+//----------------------------------------------------------------------------//
+NullRenderer& NullRenderer::create(const Size& display_size)
+{
+    return *new NullRenderer(display_size);
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::destroy(NullRenderer& renderer)
+{
+    delete &renderer;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::setActiveRenderTarget(NullRenderTarget* target)
+{
+    if (target && target != d_activeTarget)
+        ++d_stats.d_renderTargetSwitches;
+
+    d_activeTarget = target;
+}
+
+//----------------------------------------------------------------------------//
+NullRenderTarget* NullRenderer::getActiveRenderTarget() const
+{
+    return d_activeTarget;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::recordGeometryAppended(uint vertex_count)
+{
+    d_stats.d_verticesAppended += vertex_count;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::recordGeometryBufferDraw(const Rect& clip_region)
+{
+    ++d_stats.d_geometryBuffersDrawn;
+
+    if (!d_lastClipRegionValid || clip_region != d_lastClipRegion)
+    {
+        ++d_stats.d_scissorChanges;
+        d_lastClipRegion = clip_region;
+        d_lastClipRegionValid = true;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::recordBatchDraw(const Texture* texture, uint vertex_count)
+{
+    ++d_stats.d_batchesDrawn;
+    d_stats.d_verticesDrawn += vertex_count;
+
+    if (!d_lastTextureValid || texture != d_lastTexture)
+    {
+        ++d_stats.d_textureSwitches;
+        d_lastTexture = texture;
+        d_lastTextureValid = true;
+    }
+}
+
+//----------------------------------------------------------------------------//
+RenderingRoot& NullRenderer::getDefaultRenderingRoot()
+{
+    return *d_defaultRoot;
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& NullRenderer::createGeometryBuffer()
+{
+    NullGeometryBuffer* b = new NullGeometryBuffer(*this);
+    d_geometryBuffers.push_back(b);
+    return *b;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::destroyGeometryBuffer(const GeometryBuffer& buffer)
+{
+    GeometryBufferList::iterator i = std::find(d_geometryBuffers.begin(),
+                                     d_geometryBuffers.end(),
+                                     &buffer);
+
+    if (d_geometryBuffers.end() != i)
+    {
+        d_geometryBuffers.erase(i);
+        delete &buffer;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::destroyAllGeometryBuffers()
+{
+    while (!d_geometryBuffers.empty())
+        destroyGeometryBuffer(**d_geometryBuffers.begin());
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* NullRenderer::createTextureTarget()
+{
+    TextureTarget* t = new NullTextureTarget(*this);
+    d_textureTargets.push_back(t);
+    return t;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::destroyTextureTarget(TextureTarget* target)
+{
+    TextureTargetList::iterator i = std::find(d_textureTargets.begin(),
+                                    d_textureTargets.end(),
+                                    target);
+
+    if (d_textureTargets.end() != i)
+    {
+        d_textureTargets.erase(i);
+        delete target;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::destroyAllTextureTargets()
+{
+    while (!d_textureTargets.empty())
+        destroyTextureTarget(*d_textureTargets.begin());
+}
+
+//----------------------------------------------------------------------------//
+Texture& NullRenderer::createTexture()
+{
+    NullTexture* tex = new NullTexture();
+    d_textures.push_back(tex);
+    return *tex;
+}
+
+//----------------------------------------------------------------------------//
+Texture& NullRenderer::createTexture(const String& filename,
+        const String& resourceGroup)
+{
+    NullTexture* tex = new NullTexture(filename, resourceGroup);
+    d_textures.push_back(tex);
+    return *tex;
+}
+
+//----------------------------------------------------------------------------//
+Texture& NullRenderer::createTexture(const Size& size)
+{
+    NullTexture* tex = new NullTexture(size);
+    d_textures.push_back(tex);
+    return *tex;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::destroyTexture(Texture& texture)
+{
+    TextureList::iterator i = std::find(d_textures.begin(),
+                                        d_textures.end(),
+                                        &texture);
+
+    if (d_textures.end() != i)
+    {
+        d_textures.erase(i);
+        delete &static_cast<NullTexture&>(texture);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::destroyAllTextures()
+{
+    while (!d_textures.empty())
+        destroyTexture(**d_textures.begin());
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::beginRendering()
+{
+    d_stats.reset();
+    d_lastTextureValid = false;
+    d_lastClipRegionValid = false;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::endRendering()
+{
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::setDisplaySize(const Size& sz)
+{
+    if (sz != d_displaySize)
+    {
+        d_displaySize = sz;
+
+        Rect area(d_defaultTarget->getArea());
+        area.setSize(sz);
+        d_defaultTarget->setArea(area);
+    }
+}
+
+//----------------------------------------------------------------------------//
+const Size& NullRenderer::getDisplaySize() const
+{
+    return d_displaySize;
+}
+
+//----------------------------------------------------------------------------//
+const Vector2& NullRenderer::getDisplayDPI() const
+{
+    return d_displayDPI;
+}
+
+//----------------------------------------------------------------------------//
+uint NullRenderer::getMaxTextureSize() const
+{
+    return s_maxTextureSize;
+}
+
+//----------------------------------------------------------------------------//
+const String& NullRenderer::getIdentifierString() const
+{
+    return d_rendererID;
+}
+
+//----------------------------------------------------------------------------//
+const RenderStatistics* NullRenderer::getRenderStatistics() const
+{
+    return &d_stats;
+}
+
+//----------------------------------------------------------------------------//
+NullRenderer::NullRenderer(const Size& display_size) :
+    d_displaySize(display_size),
+    d_displayDPI(96, 96),
+    d_defaultRoot(0),
+    d_defaultTarget(0),
+    d_activeTarget(0),
+    d_lastTexture(0),
+    d_lastClipRegion(0, 0, 0, 0),
+    d_lastTextureValid(false),
+    d_lastClipRegionValid(false)
+{
+    d_defaultTarget = new NullRenderTarget(*this);
+    d_defaultTarget->setArea(Rect(Vector2(0, 0), d_displaySize));
+    d_defaultRoot = new RenderingRoot(*d_defaultTarget);
+}
+
+//----------------------------------------------------------------------------//
+NullRenderer::~NullRenderer()
+{
+    destroyAllGeometryBuffers();
+    destroyAllTextureTargets();
+    destroyAllTextures();
+
+    delete d_defaultRoot;
+    delete d_defaultTarget;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "../../CEGUIBase.h"
+#include "../../CEGUIRenderer.h"
+#include "../../CEGUIRenderStatistics.h"
+#include "../../CEGUISize.h"
+#include "../../CEGUIVector.h"
+#include "../../CEGUIRect.h"
+
+#include <vector>
+
+#if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
+#   ifdef CEGUINULLRENDERER_EXPORTS
+#       define NULL_GUIRENDERER_API __declspec(dllexport)
+#   else
+#       define NULL_GUIRENDERER_API __declspec(dllimport)
+#   endif
+#else
+#   define NULL_GUIRENDERER_API
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class NullTexture;
+class NullGeometryBuffer;
+class NullRenderTarget;
+
+/*!
+\brief
+    Renderer class that draws nothing at all.
+
+    Geometry added to buffers created by the NullRenderer is discarded; only
+    the number of vertices, batches, texture switches, scissor changes and
+    render target switches are counted.  This allows the CPU cost of the GUI
+    side of rendering (Window::render, bufferGeometry, queueGeometry and the
+    render queues) to be measured in isolation from any GPU or rasteriser.
+
+    The counters for each frame are reset in beginRendering and are available
+    from getRenderStatistics, or via System::getFrameStatistics once
+    System::renderGUI has returned.
+*/
+class NULL_GUIRENDERER_API NullRenderer : public Renderer
+{
+public:
+    /*!
+    \brief
+        Convenience function that creates the required objects to initialise the
+        CEGUI system.
+
+        This will create and initialise the following objects for you:
+        - CEGUI::NullRenderer
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::System
+
+    \param display_size
+        Size object describing the display size the renderer should report.
+
+    \return
+        Reference to the CEGUI::NullRenderer object that was created.
+    */
+    static NullRenderer& bootstrapSystem(const Size& display_size);
+
+    /*!
+    \brief
+        Convenience function to cleanup the CEGUI system and related objects
+        that were created by calling the bootstrapSystem function.
+
+        This function will destroy the following objects for you:
+        - CEGUI::System
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::NullRenderer
+
+    \note
+        If you did not initialise CEGUI by calling the bootstrapSystem function,
+        you should \e not call this, but rather delete any objects you created
+        manually.
+    */
+    static void destroySystem();
+
+    /*!
+    \brief
+        Create a NullRenderer object.
+
+    \param display_size
+        Size object describing the display size the renderer should report.
+    */
+    static NullRenderer& create(const Size& display_size);
+
+    /*!
+    \brief
+        Destroy a NullRenderer object.
+
+    \param renderer
+        The NullRenderer object to be destroyed.
+    */
+    static void destroy(NullRenderer& renderer);
+
+    //! set the NullRenderTarget that subsequent geometry is 'drawn' to.
+    void setActiveRenderTarget(NullRenderTarget* target);
+
+    //! return the NullRenderTarget that geometry is currently 'drawn' to.
+    NullRenderTarget* getActiveRenderTarget() const;
+
+    //! record that \a vertex_count vertices were added to a geometry buffer.
+    void recordGeometryAppended(uint vertex_count);
+
+    //! record the draw of a geometry buffer clipped to \a clip_region.
+    void recordGeometryBufferDraw(const Rect& clip_region);
+
+    //! record the draw of a batch of \a vertex_count vertices using \a texture.
+    void recordBatchDraw(const Texture* texture, uint vertex_count);
+
+    // implement Renderer interface
+    RenderingRoot& getDefaultRenderingRoot();
+    GeometryBuffer& createGeometryBuffer();
+    void destroyGeometryBuffer(const GeometryBuffer& buffer);
+    void destroyAllGeometryBuffers();
+    TextureTarget* createTextureTarget();
+    void destroyTextureTarget(TextureTarget* target);
+    void destroyAllTextureTargets();
+    Texture& createTexture();
+    Texture& createTexture(const String& filename, const String& resourceGroup);
+    Texture& createTexture(const Size& size);
+    void destroyTexture(Texture& texture);
+    void destroyAllTextures();
+    void beginRendering();
+    void endRendering();
+    void setDisplaySize(const Size& sz);
+    const Size& getDisplaySize() const;
+    const Vector2& getDisplayDPI() const;
+    uint getMaxTextureSize() const;
+    const String& getIdentifierString() const;
+    const RenderStatistics* getRenderStatistics() const;
+
+private:
+    //! Constructor for Null Renderer objects.
+    NullRenderer(const Size& display_size);
+
+    //! Destructor for NullRenderer objects.
+    virtual ~NullRenderer();
+
+    //! String holding the renderer identification text.
+    static String d_rendererID;
+    //! What the renderer considers to be the current display size.
+    Size d_displaySize;
+    //! What the renderer considers to be the current display DPI resolution.
+    Vector2 d_displayDPI;
+    //! The default rendering root object
+    RenderingRoot* d_defaultRoot;
+    //! The default RenderTarget (used by d_defaultRoot)
+    NullRenderTarget* d_defaultTarget;
+    //! container type used to hold TextureTargets we create.
+    typedef std::vector<TextureTarget*> TextureTargetList;
+    //! Container used to track texture targets.
+    TextureTargetList d_textureTargets;
+    //! container type used to hold GeometryBuffers we create.
+    typedef std::vector<NullGeometryBuffer*> GeometryBufferList;
+    //! Container used to track geometry buffers.
+    GeometryBufferList d_geometryBuffers;
+    //! container type used to hold Textures we create.
+    typedef std::vector<NullTexture*> TextureList;
+    //! Container used to track textures.
+    TextureList d_textures;
+    //! RenderTarget that is currently active.
+    NullRenderTarget* d_activeTarget;
+    //! counters for the current frame.
+    RenderStatistics d_stats;
+    //! texture used by the last batch drawn.
+    const Texture* d_lastTexture;
+    //! clip region used by the last geometry buffer drawn.
+    Rect d_lastClipRegion;
+    //! true when d_lastTexture holds a texture set during this frame.
+    bool d_lastTextureValid;
+    //! true when d_lastClipRegion holds a region set during this frame.
+    bool d_lastClipRegionValid;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
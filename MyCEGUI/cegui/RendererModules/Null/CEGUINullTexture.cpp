@@ -0,0 +1,155 @@
+#include "CEGUINullTexture.h"
+#include "CEGUIExceptions.h"
+#include "CEGUISystem.h"
+#include "CEGUIImageCodec.h"
+
+#include <cstring>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+NullTexture::NullTexture() :
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0)
+{
+}
+
+//----------------------------------------------------------------------------//
+NullTexture::NullTexture(const String& filename, const String& resourceGroup) :
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0)
+{
+    loadFromFile(filename, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+NullTexture::NullTexture(const Size& sz) :
+    d_size(0, 0),
+    d_dataSize(sz),
+    d_texelScaling(0, 0)
+{
+    setTextureSize(sz);
+    updateCachedScaleValues();
+}
+
+//----------------------------------------------------------------------------//
+NullTexture::~NullTexture()
+{
+}
+
+//----------------------------------------------------------------------------//
+void NullTexture::setTextureSize(const Size& sz)
+{
+    d_size.d_width  = static_cast<float>(static_cast<uint>(sz.d_width));
+    d_size.d_height = static_cast<float>(static_cast<uint>(sz.d_height));
+}
+
+//----------------------------------------------------------------------------//
+void NullTexture::setOriginalDataSize(const Size& sz)
+{
+    d_dataSize = sz;
+    updateCachedScaleValues();
+}
+
+//----------------------------------------------------------------------------//
+const Size& NullTexture::getSize() const
+{
+    return d_size;
+}
+
+//----------------------------------------------------------------------------//
+const Size& NullTexture::getOriginalDataSize() const
+{
+    return d_dataSize;
+}
+
+//----------------------------------------------------------------------------//
+const Vector2& NullTexture::getTexelScaling() const
+{
+    return d_texelScaling;
+}
+
+//----------------------------------------------------------------------------//
+void NullTexture::loadFromFile(const String& filename,
+                               const String& resourceGroup)
+{
+    // get and check existence of CEGUI::System object
+    System* sys = System::getSingletonPtr();
+    if (!sys)
+        CEGUI_THROW(RendererException("NullTexture::loadFromFile - "
+            "CEGUI::System object has not been created!"));
+
+    // load file to memory via resource provider
+    RawDataContainer texFile;
+    sys->getResourceProvider()->loadRawDataContainer(filename, texFile,
+            resourceGroup);
+
+    // the image is still decoded so that we learn its real size.
+    Texture* res = sys->getImageCodec().load(texFile, this);
+
+    // unload file data buffer
+    sys->getResourceProvider()->unloadRawDataContainer(texFile);
+
+    if (!res)
+        // It's an error
+        CEGUI_THROW(RendererException("NullTexture::loadFromFile - " +
+            sys->getImageCodec().getIdentifierString() +
+            " failed to load image '" + filename + "'."));
+}
+
+//----------------------------------------------------------------------------//
+void NullTexture::loadFromMemory(const void* /*buffer*/,
+                                 const Size& buffer_size,
+                                 PixelFormat pixel_format)
+{
+    if (pixel_format != PF_RGB && pixel_format != PF_RGBA)
+        CEGUI_THROW(RendererException("NullTexture::loadFromMemory failed: "
+            "Invalid PixelFormat value specified."));
+
+    setTextureSize(buffer_size);
+    d_dataSize = d_size;
+    updateCachedScaleValues();
+}
+
+//----------------------------------------------------------------------------//
+void NullTexture::saveToMemory(void* buffer)
+{
+    // there is no content, so hand back transparent black.
+    std::memset(buffer, 0, static_cast<size_t>(d_size.d_width) *
+                           static_cast<size_t>(d_size.d_height) * 4);
+}
+
+//----------------------------------------------------------------------------//
+void NullTexture::updateCachedScaleValues()
+{
+    //
+    // calculate what to use for x scale
+    //
+    const float orgW = d_dataSize.d_width;
+    const float texW = d_size.d_width;
+
+    // if texture and original data width are the same, scale is based
+    // on the original size.
+    // if texture is wider (and source data was not stretched), scale
+    // is based on the size of the resulting texture.
+    d_texelScaling.d_x = 1.0f / ((orgW == texW) ? orgW : texW);
+
+    //
+    // calculate what to use for y scale
+    //
+    const float orgH = d_dataSize.d_height;
+    const float texH = d_size.d_height;
+
+    // if texture and original data height are the same, scale is based
+    // on the original size.
+    // if texture is taller (and source data was not stretched), scale
+    // is based on the size of the resulting texture.
+    d_texelScaling.d_y = 1.0f / ((orgH == texH) ? orgH : texH);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
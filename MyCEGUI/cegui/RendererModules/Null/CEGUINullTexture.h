@@ -0,0 +1,73 @@
+#pragma once
+
+#include "../../CEGUIBase.h"
+#include "../../CEGUIRenderer.h"
+#include "../../CEGUITexture.h"
+#include "CEGUINullRenderer.h"
+
+namespace CEGUI
+{
+/*!
+\brief
+    Texture implementation for the NullRenderer.
+
+    No pixel data is kept; the texture only tracks the sizes of the data that
+    was loaded into it so that imagery and fonts can be laid out exactly as
+    they would be with a real renderer.
+*/
+class NULL_GUIRENDERER_API NullTexture : public Texture
+{
+public:
+    /*!
+    \brief
+        Set the size of the (nonexistent) texture memory.  This is used by
+        texture targets.
+    */
+    void setTextureSize(const Size& sz);
+
+    /*!
+    \brief
+        Sets what the texture should consider as the original data size.
+
+    \note
+        This also causes the texel scaling values to be updated.
+    */
+    void setOriginalDataSize(const Size& sz);
+
+    // implement abstract members from base class.
+    const Size& getSize() const;
+    const Size& getOriginalDataSize() const;
+    const Vector2& getTexelScaling() const;
+    void loadFromFile(const String& filename, const String& resourceGroup);
+    void loadFromMemory(const void* buffer, const Size& buffer_size,
+                        PixelFormat pixel_format);
+    void saveToMemory(void* buffer);
+
+protected:
+    // Friends (to allow construction and destruction)
+    friend Texture& NullRenderer::createTexture(void);
+    friend Texture& NullRenderer::createTexture(const String&, const String&);
+    friend Texture& NullRenderer::createTexture(const Size&);
+    friend void NullRenderer::destroyTexture(Texture&);
+
+    //! Basic constructor.
+    NullTexture();
+    //! Construct texture from an image file.
+    NullTexture(const String& filename, const String& resourceGroup);
+    //! Construct texture with a given size.
+    NullTexture(const Size& sz);
+    //! Destructor.
+    virtual ~NullTexture();
+
+    //! updates cached scale value used to map pixels to texture co-ords.
+    void updateCachedScaleValues();
+
+    //! Size of the texture.
+    Size d_size;
+    //! original pixel of size data loaded into texture
+    Size d_dataSize;
+    //! cached pixel to texel mapping scale values.
+    Vector2 d_texelScaling;
+};
+
+}
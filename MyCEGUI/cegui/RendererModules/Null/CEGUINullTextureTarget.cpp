@@ -0,0 +1,64 @@
+#include "CEGUINullTextureTarget.h"
+#include "CEGUINullTexture.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const float NullTextureTarget::DEFAULT_SIZE = 128.0f;
+
+//----------------------------------------------------------------------------//
+NullTextureTarget::NullTextureTarget(NullRenderer& owner) :
+    NullRenderTarget(owner)
+{
+    // this essentially creates a 'null' CEGUI::Texture
+    d_texture = &static_cast<NullTexture&>(d_owner.createTexture());
+
+    // setup area and cause the initial texture to be sized.
+    declareRenderSize(Size(DEFAULT_SIZE, DEFAULT_SIZE));
+}
+
+//----------------------------------------------------------------------------//
+NullTextureTarget::~NullTextureTarget()
+{
+    d_owner.destroyTexture(*d_texture);
+}
+
+//----------------------------------------------------------------------------//
+void NullTextureTarget::declareRenderSize(const Size& sz)
+{
+    // exit if current size is enough
+    if ((d_area.getWidth() >= sz.d_width) && (d_area.getHeight() >=sz.d_height))
+        return;
+
+    setArea(Rect(d_area.getPosition(), sz));
+    d_texture->setTextureSize(sz);
+    d_texture->setOriginalDataSize(sz);
+}
+
+//----------------------------------------------------------------------------//
+bool NullTextureTarget::isImageryCache() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void NullTextureTarget::clear()
+{
+}
+
+//----------------------------------------------------------------------------//
+Texture& NullTextureTarget::getTexture() const
+{
+    return *d_texture;
+}
+
+//----------------------------------------------------------------------------//
+bool NullTextureTarget::isRenderingInverted() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CEGUINullRenderTarget.h"
+#include "../../CEGUITextureTarget.h"
+#include "../../CEGUIRect.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4250)
+#endif
+
+namespace CEGUI
+{
+class NullTexture;
+
+//! NullTextureTarget - 'renders' into a NullTexture.
+class NULL_GUIRENDERER_API NullTextureTarget : public NullRenderTarget,
+                                               public TextureTarget
+{
+public:
+    NullTextureTarget(NullRenderer& owner);
+    virtual ~NullTextureTarget();
+
+    // implementation of RenderTarget interface
+    bool isImageryCache() const;
+    // implementation of TextureTarget interface
+    void clear();
+    Texture& getTexture() const;
+    void declareRenderSize(const Size& sz);
+    bool isRenderingInverted() const;
+
+protected:
+    //! default size of created texture objects
+    static const float DEFAULT_SIZE;
+
+    //! the texture that's 'rendered' to.
+    NullTexture* d_texture;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
@@ -0,0 +1,608 @@
+#include "CEGUISoftwareGeometryBuffer.h"
+#include "CEGUISoftwareRenderTarget.h"
+#include "CEGUISoftwareTexture.h"
+#include "CEGUIRenderEffect.h"
+#include "CEGUIVertex.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+static const float s_degToRad = 0.0174532925f;
+
+//----------------------------------------------------------------------------//
+// multiply two 8 bit channel values, giving a correctly rounded 8 bit result.
+static inline uint mulChannel(uint a, uint b)
+{
+    const uint t = a * b + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+//----------------------------------------------------------------------------//
+// blend the ARGB value \a src over the ARGB value \a dst according to \a mode.
+static inline argb_t blendPixel(argb_t src, argb_t dst, BlendMode mode)
+{
+    const uint sa = src >> 24;
+
+    if (sa == 0xFF && mode != BM_RTT_PREMULTIPLIED)
+        return src;
+
+    const uint inv_sa = 255 - sa;
+    const uint da = dst >> 24;
+
+    uint r, g, b, a;
+    if (mode == BM_RTT_PREMULTIPLIED)
+    {
+        r = ((src >> 16) & 0xFF) + mulChannel((dst >> 16) & 0xFF, inv_sa);
+        g = ((src >> 8) & 0xFF) + mulChannel((dst >> 8) & 0xFF, inv_sa);
+        b = (src & 0xFF) + mulChannel(dst & 0xFF, inv_sa);
+        a = sa + mulChannel(da, inv_sa);
+    }
+    else
+    {
+        // colour: src * src_alpha + dst * (1 - src_alpha)
+        // alpha:  src_alpha * (1 - dst_alpha) + dst_alpha
+        r = mulChannel((src >> 16) & 0xFF, sa) +
+            mulChannel((dst >> 16) & 0xFF, inv_sa);
+        g = mulChannel((src >> 8) & 0xFF, sa) +
+            mulChannel((dst >> 8) & 0xFF, inv_sa);
+        b = mulChannel(src & 0xFF, sa) + mulChannel(dst & 0xFF, inv_sa);
+        a = mulChannel(sa, 255 - da) + da;
+    }
+
+    return (ceguimin(a, 255u) << 24) | (ceguimin(r, 255u) << 16) |
+           (ceguimin(g, 255u) << 8) | ceguimin(b, 255u);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareGeometryBuffer::SoftwareGeometryBuffer(SoftwareRenderer& owner) :
+    d_owner(owner),
+    d_activeTexture(0),
+    d_matrixValid(false),
+    d_matrixIsTranslation(true),
+    d_projectedCount(0),
+    d_projectedTarget(0),
+    d_projectedArea(0, 0, 0, 0)
+{
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::draw() const
+{
+    SoftwareRenderTarget* const target = d_owner.getActiveRenderTarget();
+    if (!target || !target->getPixelBuffer())
+        return;
+
+    // final clip region is the scissor rect limited to the target surface.
+    const Rect surface(0, 0,
+                       static_cast<float>(target->getPixelBufferWidth()),
+                       static_cast<float>(target->getPixelBufferHeight()));
+    const Rect clip(d_clipRect.getIntersection(surface));
+
+    if ((clip.getWidth() <= 0) || (clip.getHeight() <= 0))
+        return;
+
+    // apply the transformations we need to use.
+    if (!d_matrixValid)
+        updateMatrix();
+
+    // positions on the target are kept from earlier frames where possible.
+    const float* const projected = projectVertices(*target);
+
+    // when only parts of the display are being redrawn, pixels outside of
+    // those parts must be left as they are.
+    const std::vector<Rect>* const region =
+        target->isImageryCache() ? 0 : d_owner.getRedrawRegion();
+    const size_t area_count = region ? region->size() : 1;
+
+    const int pass_count = d_effect ? d_effect->getPassCount() : 1;
+    for (int pass = 0; pass < pass_count; ++pass)
+    {
+        // set up RenderEffect
+        if (d_effect)
+            d_effect->performPreRenderFunctions(pass);
+
+        for (size_t a = 0; a < area_count; ++a)
+        {
+            const Rect area(region ? clip.getIntersection((*region)[a]) : clip);
+            if ((area.getWidth() <= 0) || (area.getHeight() <= 0))
+                continue;
+
+            // draw the batches
+            size_t pos = 0;
+            BatchList::const_iterator i = d_batches.begin();
+            for ( ; i != d_batches.end(); ++i)
+            {
+                drawBatch(*target, (*i).first, &d_vertices[pos],
+                          projected ? &projected[pos * 2] : 0, (*i).second,
+                          area);
+                pos += (*i).second;
+            }
+        }
+    }
+
+    // clean up RenderEffect
+    if (d_effect)
+        d_effect->performPostRenderFunctions();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::drawBatch(SoftwareRenderTarget& target,
+                                       const SoftwareTexture* tex,
+                                       const SoftwareVertex* vbuff,
+                                       const float* projected, uint count,
+                                       const Rect& clip) const
+{
+    argb_t* const pixels = target.getPixelBuffer();
+    const int pitch = static_cast<int>(target.getPixelBufferWidth());
+
+    const argb_t* const texels = tex ? tex->getPixels() : 0;
+    const int tex_w = texels ? static_cast<int>(tex->getSize().d_width) : 0;
+    const int tex_h = texels ? static_cast<int>(tex->getSize().d_height) : 0;
+
+    const int clip_left   = static_cast<int>(clip.d_left);
+    const int clip_top    = static_cast<int>(clip.d_top);
+    const int clip_right  = static_cast<int>(clip.d_right);
+    const int clip_bottom = static_cast<int>(clip.d_bottom);
+
+    for (uint tri = 0; tri + 2 < count; tri += 3)
+    {
+        // positions of the three corners on the target surface
+        float sx[3], sy[3], col[3][4], u[3], v[3];
+        for (int c = 0; c < 3; ++c)
+        {
+            const SoftwareVertex& vtx = vbuff[tri + c];
+
+            if (projected)
+            {
+                sx[c] = projected[(tri + c) * 2];
+                sy[c] = projected[(tri + c) * 2 + 1];
+            }
+            else
+                projectVertex(target, vtx, sx[c], sy[c]);
+
+            col[c][0] = static_cast<float>((vtx.diffuse >> 24) & 0xFF);
+            col[c][1] = static_cast<float>((vtx.diffuse >> 16) & 0xFF);
+            col[c][2] = static_cast<float>((vtx.diffuse >> 8) & 0xFF);
+            col[c][3] = static_cast<float>(vtx.diffuse & 0xFF);
+            u[c] = vtx.tu;
+            v[c] = vtx.tv;
+        }
+
+        float area = (sx[1] - sx[0]) * (sy[2] - sy[0]) -
+                     (sy[1] - sy[0]) * (sx[2] - sx[0]);
+
+        // degenerate triangle
+        if (area == 0.0f)
+            continue;
+
+        // keep a consistent winding so the edge tests below are all >= 0
+        int i0 = 0, i1 = 1, i2 = 2;
+        if (area < 0.0f)
+        {
+            std::swap(i1, i2);
+            area = -area;
+        }
+
+        const float x0 = sx[i0], y0 = sy[i0];
+        const float x1 = sx[i1], y1 = sy[i1];
+        const float x2 = sx[i2], y2 = sy[i2];
+
+        // bounding box of the triangle, limited to the clip region
+        const int min_x = ceguimax(clip_left, static_cast<int>(
+            std::floor(ceguimin(x0, ceguimin(x1, x2)))));
+        const int max_x = ceguimin(clip_right, static_cast<int>(
+            std::ceil(ceguimax(x0, ceguimax(x1, x2)))));
+        const int min_y = ceguimax(clip_top, static_cast<int>(
+            std::floor(ceguimin(y0, ceguimin(y1, y2)))));
+        const int max_y = ceguimin(clip_bottom, static_cast<int>(
+            std::ceil(ceguimax(y0, ceguimax(y1, y2)))));
+
+        if (min_x >= max_x || min_y >= max_y)
+            continue;
+
+        // edge function steps
+        const float e0_dx = y1 - y2, e0_dy = x2 - x1;
+        const float e1_dx = y2 - y0, e1_dy = x0 - x2;
+        const float e2_dx = y0 - y1, e2_dy = x1 - x0;
+
+        // top-left fill convention, so shared edges are only drawn once.
+        const bool e0_tl = (y2 < y1) || (y2 == y1 && x2 > x1);
+        const bool e1_tl = (y0 < y2) || (y0 == y2 && x0 > x2);
+        const bool e2_tl = (y1 < y0) || (y1 == y0 && x1 > x0);
+
+        const float inv_area = 1.0f / area;
+        const bool flat_colour =
+            vbuff[tri].diffuse == vbuff[tri + 1].diffuse &&
+            vbuff[tri].diffuse == vbuff[tri + 2].diffuse;
+
+        const float px0 = static_cast<float>(min_x) + 0.5f;
+        for (int py = min_y; py < max_y; ++py)
+        {
+            const float pyc = static_cast<float>(py) + 0.5f;
+
+            float w0 = (x2 - x1) * (pyc - y1) - (y2 - y1) * (px0 - x1);
+            float w1 = (x0 - x2) * (pyc - y2) - (y0 - y2) * (px0 - x2);
+            float w2 = (x1 - x0) * (pyc - y0) - (y1 - y0) * (px0 - x0);
+
+            argb_t* dst = &pixels[py * pitch + min_x];
+
+            for (int px = min_x; px < max_x;
+                 ++px, ++dst, w0 += e0_dx, w1 += e1_dx, w2 += e2_dx)
+            {
+                if ((w0 < 0.0f || (w0 == 0.0f && !e0_tl)) ||
+                    (w1 < 0.0f || (w1 == 0.0f && !e1_tl)) ||
+                    (w2 < 0.0f || (w2 == 0.0f && !e2_tl)))
+                    continue;
+
+                const float b0 = w0 * inv_area;
+                const float b1 = w1 * inv_area;
+                const float b2 = w2 * inv_area;
+
+                uint ca, cr, cg, cb;
+                if (flat_colour)
+                {
+                    ca = static_cast<uint>(col[0][0]);
+                    cr = static_cast<uint>(col[0][1]);
+                    cg = static_cast<uint>(col[0][2]);
+                    cb = static_cast<uint>(col[0][3]);
+                }
+                else
+                {
+                    ca = static_cast<uint>(b0 * col[i0][0] + b1 * col[i1][0] +
+                                           b2 * col[i2][0] + 0.5f);
+                    cr = static_cast<uint>(b0 * col[i0][1] + b1 * col[i1][1] +
+                                           b2 * col[i2][1] + 0.5f);
+                    cg = static_cast<uint>(b0 * col[i0][2] + b1 * col[i1][2] +
+                                           b2 * col[i2][2] + 0.5f);
+                    cb = static_cast<uint>(b0 * col[i0][3] + b1 * col[i1][3] +
+                                           b2 * col[i2][3] + 0.5f);
+                }
+
+                // modulate with the texel (nearest sample, clamped addressing)
+                if (texels)
+                {
+                    const float tu = b0 * u[i0] + b1 * u[i1] + b2 * u[i2];
+                    const float tv = b0 * v[i0] + b1 * v[i1] + b2 * v[i2];
+                    const int tx = ceguimax(0, ceguimin(tex_w - 1,
+                        static_cast<int>(std::floor(tu * tex_w))));
+                    const int ty = ceguimax(0, ceguimin(tex_h - 1,
+                        static_cast<int>(std::floor(tv * tex_h))));
+                    const argb_t t = texels[ty * tex_w + tx];
+
+                    ca = mulChannel(ca, t >> 24);
+                    cr = mulChannel(cr, (t >> 16) & 0xFF);
+                    cg = mulChannel(cg, (t >> 8) & 0xFF);
+                    cb = mulChannel(cb, t & 0xFF);
+                }
+
+                const argb_t src = (ceguimin(ca, 255u) << 24) |
+                                   (ceguimin(cr, 255u) << 16) |
+                                   (ceguimin(cg, 255u) << 8) |
+                                   ceguimin(cb, 255u);
+
+                *dst = blendPixel(src, *dst, d_blendMode);
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setTranslation(const Vector3& t)
+{
+    d_translation = t;
+    d_matrixValid = false;
+    d_projectedCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setRotation(const Vector3& r)
+{
+    d_rotation = r;
+    d_matrixValid = false;
+    d_projectedCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setPivot(const Vector3& p)
+{
+    d_pivot = p;
+    d_matrixValid = false;
+    d_projectedCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setClippingRegion(const Rect& region)
+{
+    d_clipRect.d_top    = ceguimax(0.0f, PixelAligned(region.d_top));
+    d_clipRect.d_bottom = ceguimax(0.0f, PixelAligned(region.d_bottom));
+    d_clipRect.d_left   = ceguimax(0.0f, PixelAligned(region.d_left));
+    d_clipRect.d_right  = ceguimax(0.0f, PixelAligned(region.d_right));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::appendVertex(const Vertex& vertex)
+{
+    appendGeometry(&vertex, 1);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::appendGeometry(const Vertex* const vbuff,
+                                            uint vertex_count)
+{
+    if (!vertex_count)
+        return;
+
+    performBatchManagement();
+
+    // update size of current batch
+    d_batches.back().second += vertex_count;
+
+    // grow the buffer once, then convert straight into the new space from
+    // CEGUI::Vertex to something directly usable by the rasteriser.
+    const size_t first = d_vertices.size();
+    d_vertices.resize(first + vertex_count);
+    VertexConversion::convert(vbuff, &d_vertices[first], vertex_count);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::appendQuads(const GeometryQuad* const quads,
+                                         uint quad_count)
+{
+    if (!quad_count)
+        return;
+
+    performBatchManagement();
+
+    const uint vertex_count = quad_count * 6;
+
+    // update size of current batch
+    d_batches.back().second += vertex_count;
+
+    // grow the buffer once, then generate the vertices in place.
+    const size_t first = d_vertices.size();
+    d_vertices.resize(first + vertex_count);
+
+    SoftwareVertex* vd = &d_vertices[first];
+    const GeometryQuad* q = quads;
+    for (uint i = 0; i < quad_count; ++i, ++q)
+    {
+        const float left   = q->position.d_left;
+        const float top    = q->position.d_top;
+        const float right  = q->position.d_right;
+        const float bottom = q->position.d_bottom;
+
+        // the four distinct vertices, in QuadCorner order.
+        const SoftwareVertex corners[4] =
+        {
+            { left, top, q->z, q->top_left,
+              q->tex_coords.d_left, q->tex_coords.d_top },
+            { right, top, q->z, q->top_right,
+              q->tex_coords.d_right, q->tex_coords.d_top },
+            { left, bottom, q->z, q->bottom_left,
+              q->tex_coords.d_left, q->tex_coords.d_bottom },
+            { right, bottom, q->z, q->bottom_right,
+              q->tex_coords.d_right, q->tex_coords.d_bottom }
+        };
+
+        const int* const order =
+            s_quadCorners[q->split_mode == TopLeftToBottomRight ? 0 : 1];
+
+        for (int v = 0; v < 6; ++v)
+            *vd++ = corners[order[v]];
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setActiveTexture(Texture* texture)
+{
+    d_activeTexture = static_cast<SoftwareTexture*>(texture);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::reset()
+{
+    d_batches.clear();
+    d_vertices.clear();
+    d_activeTexture = 0;
+    // keep our space in the projected vertex store, but refill it.
+    d_projectedCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+Texture* SoftwareGeometryBuffer::getActiveTexture() const
+{
+    return d_activeTexture;
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareGeometryBuffer::getVertexCount() const
+{
+    return d_vertices.size();
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareGeometryBuffer::getBatchCount() const
+{
+    return d_batches.size();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setRenderEffect(RenderEffect* effect)
+{
+    d_effect = effect;
+}
+
+//----------------------------------------------------------------------------//
+RenderEffect* SoftwareGeometryBuffer::getRenderEffect()
+{
+    return d_effect;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareGeometryBuffer::isMergeableWith(const GeometryBuffer& buffer) const
+{
+    const SoftwareGeometryBuffer& other =
+        static_cast<const SoftwareGeometryBuffer&>(buffer);
+
+    // merging is only worthwhile if it joins batches using the same texture.
+    return isMergeCompatibleWith(other) &&
+           d_batches.back().first == other.d_batches.front().first;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::appendMergedGeometry(const GeometryBuffer& buffer)
+{
+    const SoftwareGeometryBuffer& other =
+        static_cast<const SoftwareGeometryBuffer&>(buffer);
+
+    mergeStateOf(other);
+
+    const Rect& clip = other.d_clipRect;
+
+    size_t pos = 0;
+    BatchList::const_iterator i = other.d_batches.begin();
+    for ( ; i != other.d_batches.end(); ++i)
+    {
+        if (d_batches.empty() || (d_batches.back().first != (*i).first))
+            d_batches.push_back(BatchInfo((*i).first, 0));
+
+        d_batches.back().second += VertexConversion::appendClippedTriangles(
+            &other.d_vertices[pos], (*i).second,
+            other.d_translation.d_x, other.d_translation.d_y, clip, d_vertices);
+        pos += (*i).second;
+
+        // drop the batch again if everything in it was clipped away.
+        if (!d_batches.back().second)
+            d_batches.pop_back();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::performBatchManagement()
+{
+    // create a new batch if there are no batches yet, or if the active texture
+    // differs from that used by the current batch.
+    if (d_batches.empty() || (d_activeTexture != d_batches.back().first))
+        d_batches.push_back(BatchInfo(d_activeTexture, 0));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::updateMatrix() const
+{
+    // rotation built the same way as D3DXQuaternionRotationYawPitchRoll, with
+    // yaw about y, pitch about x and roll about z: R = Rz * Rx * Ry
+    const float sp = std::sin(d_rotation.d_x * s_degToRad);
+    const float cp = std::cos(d_rotation.d_x * s_degToRad);
+    const float sy = std::sin(d_rotation.d_y * s_degToRad);
+    const float cy = std::cos(d_rotation.d_y * s_degToRad);
+    const float sr = std::sin(d_rotation.d_z * s_degToRad);
+    const float cr = std::cos(d_rotation.d_z * s_degToRad);
+
+    float* const m = d_matrix;
+    m[0] = cr * cy + sr * sp * sy;
+    m[1] = sr * cp;
+    m[2] = -cr * sy + sr * sp * cy;
+    m[3] = -sr * cy + cr * sp * sy;
+    m[4] = cr * cp;
+    m[5] = sr * sy + cr * sp * cy;
+    m[6] = cp * sy;
+    m[7] = -sp;
+    m[8] = cp * cy;
+
+    // rotate about the pivot, then translate.
+    const float px = d_pivot.d_x, py = d_pivot.d_y, pz = d_pivot.d_z;
+    m[9]  = px - (px * m[0] + py * m[3] + pz * m[6]) + d_translation.d_x;
+    m[10] = py - (px * m[1] + py * m[4] + pz * m[7]) + d_translation.d_y;
+    m[11] = pz - (px * m[2] + py * m[5] + pz * m[8]) + d_translation.d_z;
+
+    d_matrixIsTranslation = (d_rotation.d_x == 0.0f) &&
+                            (d_rotation.d_y == 0.0f) &&
+                            (d_rotation.d_z == 0.0f);
+
+    d_matrixValid = true;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::projectVertex(const SoftwareRenderTarget& target,
+                                           const SoftwareVertex& vtx,
+                                           float& out_x, float& out_y) const
+{
+    const float* const m = d_matrix;
+
+    float x, y, z;
+    if (d_matrixIsTranslation)
+    {
+        x = vtx.x + m[9];
+        y = vtx.y + m[10];
+        z = vtx.z + m[11];
+    }
+    else
+    {
+        x = vtx.x * m[0] + vtx.y * m[3] + vtx.z * m[6] + m[9];
+        y = vtx.x * m[1] + vtx.y * m[4] + vtx.z * m[7] + m[10];
+        z = vtx.x * m[2] + vtx.y * m[5] + vtx.z * m[8] + m[11];
+    }
+
+    target.projectPoint(x, y, z, out_x, out_y);
+}
+
+//----------------------------------------------------------------------------//
+const float* SoftwareGeometryBuffer::projectVertices(
+    const SoftwareRenderTarget& target) const
+{
+    const uint count = d_vertices.size();
+    if (!count)
+        return 0;
+
+    VertexPool& pool = d_owner.getVertexPool();
+
+    // the projection depends on the target as well as our own transform.
+    if (&target != d_projectedTarget || target.getArea() != d_projectedArea)
+    {
+        d_projectedTarget = &target;
+        d_projectedArea = target.getArea();
+        d_projectedCount = 0;
+    }
+
+    // get new space if ours was handed to another buffer, or is too small.
+    if (!pool.isValid(d_projectedAllocation) ||
+        d_projectedAllocation.d_capacity < count)
+    {
+        if (!pool.allocate(count + count / 2, d_projectedAllocation) &&
+            !pool.allocate(count, d_projectedAllocation))
+            return 0;
+
+        d_projectedCount = 0;
+    }
+
+    float* const store = d_owner.getProjectedVertexStore() +
+                         d_projectedAllocation.d_offset * 2;
+
+    // project only what was added since the last call.
+    pool.recordUpload(count - d_projectedCount);
+    pool.recordReuse(d_projectedCount);
+
+    for (uint i = d_projectedCount; i < count; ++i)
+        projectVertex(target, d_vertices[i], store[i * 2], store[i * 2 + 1]);
+
+    d_projectedCount = count;
+
+    return store;
+}
+
+//----------------------------------------------------------------------------//
+const float* SoftwareGeometryBuffer::getMatrix() const
+{
+    if (!d_matrixValid)
+        updateMatrix();
+
+    return d_matrix;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "../../CEGUIGeometryBuffer.h"
+#include "CEGUISoftwareRenderer.h"
+#include "../../CEGUIRect.h"
+#include "../../CEGUIVertexConversion.h"
+
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class SoftwareTexture;
+class SoftwareRenderTarget;
+
+/*!
+\brief
+    Software based implementation of the GeometryBuffer interface.
+
+    Geometry is kept in system memory and rasterised, one triangle at a time,
+    into the pixel buffer of the SoftwareRenderTarget that is active when draw
+    is called.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareGeometryBuffer : public GeometryBuffer
+{
+public:
+    //! Constructor
+    SoftwareGeometryBuffer(SoftwareRenderer& owner);
+
+    /*!
+    \brief
+        return pointer to the 12 floats of the world transform.  The first
+        nine values are the rows of the rotation, the last three are the
+        translation.  Points are transformed as row vectors.
+    */
+    const float* getMatrix() const;
+
+    // implementation of abstract members from GeometryBuffer
+    void draw() const;
+    void setTranslation(const Vector3& t);
+    void setRotation(const Vector3& r);
+    void setPivot(const Vector3& p);
+    void setClippingRegion(const Rect& region);
+    void appendVertex(const Vertex& vertex);
+    void appendGeometry(const Vertex* const vbuff, uint vertex_count);
+    void appendQuads(const GeometryQuad* const quads, uint quad_count);
+    void setActiveTexture(Texture* texture);
+    void reset();
+    Texture* getActiveTexture() const;
+    uint getVertexCount() const;
+    uint getBatchCount() const;
+    void setRenderEffect(RenderEffect* effect);
+    RenderEffect* getRenderEffect();
+
+    // overrides of virtual members from GeometryBuffer
+    bool isMergeableWith(const GeometryBuffer& buffer) const;
+    void appendMergedGeometry(const GeometryBuffer& buffer);
+
+protected:
+    //! internal Vertex structure used for software rasterised geometry.
+    typedef PackedVertex SoftwareVertex;
+
+    //! perform batch management operations prior to adding new geometry.
+    void performBatchManagement();
+    //! update cached matrix
+    void updateMatrix() const;
+    //! transform \a vtx and project it onto the surface of \a target.
+    void projectVertex(const SoftwareRenderTarget& target,
+                       const SoftwareVertex& vtx,
+                       float& out_x, float& out_y) const;
+    /*!
+    \brief
+        make sure the renderer's projected vertex store holds the positions of
+        all our vertices on \a target, projecting only those added since the
+        last call.
+
+    \return
+        Pointer to the x, y pairs for our vertices, or 0 if there was no room
+        in the store.
+    */
+    const float* projectVertices(const SoftwareRenderTarget& target) const;
+    /*!
+    \brief
+        rasterise \a count vertices starting at \a vbuff into \a target.
+        \a projected holds their positions on \a target, or is 0 to project
+        them here.
+    */
+    void drawBatch(SoftwareRenderTarget& target, const SoftwareTexture* tex,
+                   const SoftwareVertex* vbuff, const float* projected,
+                   uint count, const Rect& clip) const;
+
+    //! Owning SoftwareRenderer object
+    SoftwareRenderer& d_owner;
+    //! last texture that was set as active
+    SoftwareTexture* d_activeTexture;
+    //! type to track info for per-texture sub batches of geometry
+    typedef std::pair<const SoftwareTexture*, uint> BatchInfo;
+    //! type of container that tracks BatchInfos.
+    typedef std::vector<BatchInfo> BatchList;
+    //! list of texture batches added to the geometry buffer
+    BatchList d_batches;
+    //! type of container used to queue the geometry
+    typedef std::vector<SoftwareVertex> VertexList;
+    //! container where added geometry is stored.
+    VertexList d_vertices;
+    //! model matrix cache
+    mutable float d_matrix[12];
+    //! true when d_matrix is valid and up to date
+    mutable bool d_matrixValid;
+    //! true when d_matrix contains no rotation.
+    mutable bool d_matrixIsTranslation;
+    //! space in the renderer's projected vertex store holding our vertices.
+    mutable VertexPool::Allocation d_projectedAllocation;
+    //! number of vertices from d_vertices that are in the projected store.
+    mutable uint d_projectedCount;
+    //! target that the projected vertices are for.
+    mutable const SoftwareRenderTarget* d_projectedTarget;
+    //! area of d_projectedTarget when the vertices were projected.
+    mutable Rect d_projectedArea;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
@@ -0,0 +1,143 @@
+#include "CEGUISoftwareRenderTarget.h"
+#include "CEGUISoftwareGeometryBuffer.h"
+#include "CEGUIRenderQueue.h"
+
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// tan of half the vertical field of view (30 degrees) used by all renderers.
+static const float s_tanHalfFOV = 0.267949192431123f;
+
+//----------------------------------------------------------------------------//
+SoftwareRenderTarget::SoftwareRenderTarget(SoftwareRenderer& owner) :
+    d_owner(owner),
+    d_area(0, 0, 0, 0),
+    d_viewDistance(0),
+    d_viewDistanceValid(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::draw(const GeometryBuffer& buffer)
+{
+    buffer.draw();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::draw(const RenderQueue& queue)
+{
+    queue.draw();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::setArea(const Rect& area)
+{
+    d_area = area;
+    d_viewDistanceValid = false;
+}
+
+//----------------------------------------------------------------------------//
+const Rect& SoftwareRenderTarget::getArea() const
+{
+    return d_area;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::activate()
+{
+    if (!d_viewDistanceValid)
+        updateViewDistance();
+
+    d_owner.setActiveRenderTarget(this);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::deactivate()
+{
+    if (d_owner.getActiveRenderTarget() == this)
+        d_owner.setActiveRenderTarget(0);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::projectPoint(float x, float y, float z,
+                                        float& out_x, float& out_y) const
+{
+    if (z != 0.0f)
+    {
+        if (!d_viewDistanceValid)
+            updateViewDistance();
+
+        const float midx = d_area.getWidth() * 0.5f;
+        const float midy = d_area.getHeight() * 0.5f;
+        const float scale = d_viewDistance / (d_viewDistance + z);
+
+        x = midx + (x - midx) * scale;
+        y = midy + (y - midy) * scale;
+    }
+
+    out_x = d_area.d_left + x;
+    out_y = d_area.d_top + y;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::unprojectPoint(const GeometryBuffer& buff,
+                                          const Vector2& p_in,
+                                          Vector2& p_out) const
+{
+    if (!d_viewDistanceValid)
+        updateViewDistance();
+
+    const SoftwareGeometryBuffer& gb =
+        static_cast<const SoftwareGeometryBuffer&>(buff);
+
+    // rows of the buffer's rotation and the translation part of the matrix
+    const float* const m = gb.getMatrix();
+    const float* const r0 = &m[0];
+    const float* const r1 = &m[3];
+    const float* const n  = &m[6];
+    const float* const t  = &m[9];
+
+    // ray from the eye through the point on the z = 0 plane
+    const float eye[3] = { d_area.getWidth() * 0.5f,
+                           d_area.getHeight() * 0.5f,
+                           -d_viewDistance };
+    const float dir[3] = { p_in.d_x - d_area.d_left - eye[0],
+                           p_in.d_y - d_area.d_top - eye[1],
+                           -eye[2] };
+
+    const float denom = n[0] * dir[0] + n[1] * dir[1] + n[2] * dir[2];
+
+    // ray is parallel to the buffer's plane; nothing sensible can be done.
+    if (std::fabs(denom) < 1e-6f)
+    {
+        p_out = p_in;
+        return;
+    }
+
+    const float s = (n[0] * (t[0] - eye[0]) +
+                     n[1] * (t[1] - eye[1]) +
+                     n[2] * (t[2] - eye[2])) / denom;
+
+    // intersection relative to the buffer origin
+    const float w[3] = { eye[0] + s * dir[0] - t[0],
+                         eye[1] + s * dir[1] - t[1],
+                         eye[2] + s * dir[2] - t[2] };
+
+    // rotation is orthonormal, so the transpose takes us back to buffer space
+    p_out.d_x = w[0] * r0[0] + w[1] * r0[1] + w[2] * r0[2];
+    p_out.d_y = w[0] * r1[0] + w[1] * r1[1] + w[2] * r1[2];
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::updateViewDistance() const
+{
+    d_viewDistance = (d_area.getHeight() * 0.5f) / s_tanHalfFOV;
+    d_viewDistanceValid = true;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CEGUISoftwareRenderer.h"
+#include "../../CEGUIRenderTarget.h"
+#include "../../CEGUIRect.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Intermediate Software implementation of a RenderTarget.
+
+    A SoftwareRenderTarget describes a block of ARGB pixels in system memory
+    that SoftwareGeometryBuffer objects rasterise into while the target is
+    active.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRenderTarget : public virtual RenderTarget
+{
+public:
+    //! Constructor
+    SoftwareRenderTarget(SoftwareRenderer& owner);
+
+    //! return pointer to the first pixel of the surface we render into.
+    virtual argb_t* getPixelBuffer() = 0;
+    //! return the width, in pixels, of the surface we render into.
+    virtual uint getPixelBufferWidth() const = 0;
+    //! return the height, in pixels, of the surface we render into.
+    virtual uint getPixelBufferHeight() const = 0;
+
+    /*!
+    \brief
+        Project a point from target space onto the target surface.
+
+        Points lying in the z = 0 plane map directly onto the surface (offset
+        by the target area); other points are projected using the same
+        perspective set up as the hardware renderer modules, so rotated
+        geometry looks the same.
+    */
+    void projectPoint(float x, float y, float z,
+                      float& out_x, float& out_y) const;
+
+    // implement parts of RenderTarget interface
+    void draw(const GeometryBuffer& buffer);
+    void draw(const RenderQueue& queue);
+    void setArea(const Rect& area);
+    const Rect& getArea() const;
+    void activate();
+    void deactivate();
+    void unprojectPoint(const GeometryBuffer& buff,
+                        const Vector2& p_in, Vector2& p_out) const;
+
+protected:
+    //! helper that initialises the cached view distance.
+    void updateViewDistance() const;
+
+    //! SoftwareRenderer that created this object
+    SoftwareRenderer& d_owner;
+    //! holds defined area for the RenderTarget
+    Rect d_area;
+    //! distance of the eye from the z = 0 plane.
+    mutable float d_viewDistance;
+    //! true when d_viewDistance is valid and up to date
+    mutable bool d_viewDistanceValid;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
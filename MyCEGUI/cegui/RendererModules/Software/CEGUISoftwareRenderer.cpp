@@ -0,0 +1,384 @@
+#include "CEGUISoftwareRenderer.h"
+#include "CEGUISoftwareTexture.h"
+#include "CEGUISoftwareGeometryBuffer.h"
+#include "CEGUISoftwareRenderTarget.h"
+#include "CEGUISoftwareViewportTarget.h"
+#include "CEGUISoftwareTextureTarget.h"
+#include "CEGUIRenderingRoot.h"
+#include "CEGUIExceptions.h"
+#include "CEGUISystem.h"
+#include "CEGUIDefaultResourceProvider.h"
+
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+String SoftwareRenderer::d_rendererID(
+"CEGUI::SoftwareRenderer - CPU rasterising renderer module for headless "
+"operation.");
+
+//----------------------------------------------------------------------------//
+// largest texture we are prepared to allocate in system memory.
+static const uint s_maxTextureSize = 8192;
+
+//----------------------------------------------------------------------------//
+// number of vertices that geometry buffers can keep projected between frames.
+static const uint s_vertexPoolSize = 128 * 1024;
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::bootstrapSystem(const Size& display_size)
+{
+    if (System::getSingletonPtr())
+        CEGUI_THROW(InvalidRequestException(
+            "SoftwareRenderer::bootstrapSystem: CEGUI::System object is "
+            "already initialised."));
+
+    SoftwareRenderer& renderer(create(display_size));
+    DefaultResourceProvider* rp = new CEGUI::DefaultResourceProvider();
+    System::create(renderer, rp);
+
+    return renderer;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroySystem()
+{
+    System* sys;
+    if (!(sys = System::getSingletonPtr()))
+        CEGUI_THROW(InvalidRequestException("SoftwareRenderer::destroySystem: "
+            "CEGUI::System object is not created or was already destroyed."));
+
+    SoftwareRenderer* renderer =
+        static_cast<SoftwareRenderer*>(sys->getRenderer());
+    DefaultResourceProvider* rp =
+        static_cast<DefaultResourceProvider*>(sys->getResourceProvider());
+
+    System::destroy();
+    delete rp;
+    destroy(*renderer);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::create(const Size& display_size)
+{
+    return *new SoftwareRenderer(display_size);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroy(SoftwareRenderer& renderer)
+{
+    delete &renderer;
+}
+
+//----------------------------------------------------------------------------//
+const argb_t* SoftwareRenderer::getFrameBuffer() const
+{
+    return d_frameBuffer.empty() ? 0 : &d_frameBuffer[0];
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::saveFrameBuffer(void* buffer) const
+{
+    const size_t pixel_count = d_frameBuffer.size();
+    uchar* dst = static_cast<uchar*>(buffer);
+
+    for (size_t i = 0; i < pixel_count; ++i, dst += 4)
+    {
+        const argb_t p = d_frameBuffer[i];
+        dst[0] = static_cast<uchar>((p >> 16) & 0xFF);
+        dst[1] = static_cast<uchar>((p >> 8) & 0xFF);
+        dst[2] = static_cast<uchar>(p & 0xFF);
+        dst[3] = static_cast<uchar>((p >> 24) & 0xFF);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setClearColour(const colour& col)
+{
+    d_clearColour = col;
+}
+
+//----------------------------------------------------------------------------//
+const colour& SoftwareRenderer::getClearColour() const
+{
+    return d_clearColour;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setActiveRenderTarget(SoftwareRenderTarget* target)
+{
+    d_activeTarget = target;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderTarget* SoftwareRenderer::getActiveRenderTarget() const
+{
+    return d_activeTarget;
+}
+
+//----------------------------------------------------------------------------//
+float* SoftwareRenderer::getProjectedVertexStore()
+{
+    return &d_projectedVertices[0];
+}
+
+//----------------------------------------------------------------------------//
+VertexPool& SoftwareRenderer::getVertexPool()
+{
+    return d_vertexPool;
+}
+
+//----------------------------------------------------------------------------//
+RenderingRoot& SoftwareRenderer::getDefaultRenderingRoot()
+{
+    return *d_defaultRoot;
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& SoftwareRenderer::createGeometryBuffer()
+{
+    SoftwareGeometryBuffer* b = new SoftwareGeometryBuffer(*this);
+    d_geometryBuffers.push_back(b);
+    return *b;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyGeometryBuffer(const GeometryBuffer& buffer)
+{
+    GeometryBufferList::iterator i = std::find(d_geometryBuffers.begin(),
+                                     d_geometryBuffers.end(),
+                                     &buffer);
+
+    if (d_geometryBuffers.end() != i)
+    {
+        d_geometryBuffers.erase(i);
+        delete &buffer;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllGeometryBuffers()
+{
+    while (!d_geometryBuffers.empty())
+        destroyGeometryBuffer(**d_geometryBuffers.begin());
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* SoftwareRenderer::createTextureTarget()
+{
+    TextureTarget* t = new SoftwareTextureTarget(*this);
+    d_textureTargets.push_back(t);
+    return t;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTextureTarget(TextureTarget* target)
+{
+    TextureTargetList::iterator i = std::find(d_textureTargets.begin(),
+                                    d_textureTargets.end(),
+                                    target);
+
+    if (d_textureTargets.end() != i)
+    {
+        d_textureTargets.erase(i);
+        delete target;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextureTargets()
+{
+    while (!d_textureTargets.empty())
+        destroyTextureTarget(*d_textureTargets.begin());
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture()
+{
+    SoftwareTexture* tex = new SoftwareTexture();
+    d_textures.push_back(tex);
+    return *tex;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& filename,
+        const String& resourceGroup)
+{
+    SoftwareTexture* tex = new SoftwareTexture(filename, resourceGroup);
+    d_textures.push_back(tex);
+    return *tex;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const Size& size)
+{
+    SoftwareTexture* tex = new SoftwareTexture(size);
+    d_textures.push_back(tex);
+    return *tex;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTexture(Texture& texture)
+{
+    TextureList::iterator i = std::find(d_textures.begin(),
+                                        d_textures.end(),
+                                        &texture);
+
+    if (d_textures.end() != i)
+    {
+        d_textures.erase(i);
+        delete &static_cast<SoftwareTexture&>(texture);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextures()
+{
+    while (!d_textures.empty())
+        destroyTexture(**d_textures.begin());
+}
+
+//----------------------------------------------------------------------------//
+const std::vector<Rect>* SoftwareRenderer::getRedrawRegion() const
+{
+    return d_redrawRegionActive ? &d_redrawRegion : 0;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::beginRendering()
+{
+    d_vertexPool.resetFrameCounters();
+
+    // there is no host application to clear the 'back buffer' for us, so the
+    // framebuffer is cleared here at the start of every frame.
+    if (!d_redrawRegionActive)
+    {
+        std::fill(d_frameBuffer.begin(), d_frameBuffer.end(),
+                  d_clearColour.getARGB());
+        return;
+    }
+
+    // the framebuffer keeps its content between frames, so only the parts
+    // that are to be redrawn need clearing.
+    const argb_t clear_value = d_clearColour.getARGB();
+    const size_t pitch = static_cast<size_t>(d_displaySize.d_width);
+    const Rect display(Point(0, 0), d_displaySize);
+
+    for (size_t i = 0; i < d_redrawRegion.size(); ++i)
+    {
+        const Rect area(d_redrawRegion[i].getIntersection(display));
+        const size_t left = static_cast<size_t>(area.d_left);
+        const size_t right = static_cast<size_t>(area.d_right);
+
+        if (right <= left)
+            continue;
+
+        for (size_t y = static_cast<size_t>(area.d_top);
+             y < static_cast<size_t>(area.d_bottom); ++y)
+            std::fill(&d_frameBuffer[y * pitch + left],
+                      &d_frameBuffer[y * pitch + left] + (right - left),
+                      clear_value);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::endRendering()
+{
+    d_redrawRegion.clear();
+    d_redrawRegionActive = false;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderer::setRedrawRegion(const Rect* areas, uint area_count)
+{
+    d_redrawRegion.assign(areas, areas + area_count);
+    d_redrawRegionActive = true;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderer::supportsRedrawRegion() const
+{
+    // the framebuffer is only ever drawn over, never cleared.
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setDisplaySize(const Size& sz)
+{
+    if (sz != d_displaySize)
+    {
+        d_displaySize = sz;
+        resizeFrameBuffer();
+
+        Rect area(d_defaultTarget->getArea());
+        area.setSize(sz);
+        d_defaultTarget->setArea(area);
+    }
+}
+
+//----------------------------------------------------------------------------//
+const Size& SoftwareRenderer::getDisplaySize() const
+{
+    return d_displaySize;
+}
+
+//----------------------------------------------------------------------------//
+const Vector2& SoftwareRenderer::getDisplayDPI() const
+{
+    return d_displayDPI;
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareRenderer::getMaxTextureSize() const
+{
+    return s_maxTextureSize;
+}
+
+//----------------------------------------------------------------------------//
+const String& SoftwareRenderer::getIdentifierString() const
+{
+    return d_rendererID;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::SoftwareRenderer(const Size& display_size) :
+    d_displaySize(display_size),
+    d_displayDPI(96, 96),
+    d_defaultRoot(0),
+    d_defaultTarget(0),
+    d_clearColour(0.0f, 0.0f, 0.0f, 0.0f),
+    d_activeTarget(0),
+    d_projectedVertices(s_vertexPoolSize * 2),
+    d_vertexPool(s_vertexPoolSize),
+    d_redrawRegionActive(false)
+{
+    resizeFrameBuffer();
+
+    d_defaultTarget = new SoftwareViewportTarget(*this);
+    d_defaultRoot = new RenderingRoot(*d_defaultTarget);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::~SoftwareRenderer()
+{
+    destroyAllGeometryBuffers();
+    destroyAllTextureTargets();
+    destroyAllTextures();
+
+    delete d_defaultRoot;
+    delete d_defaultTarget;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::resizeFrameBuffer()
+{
+    d_frameBuffer.resize(static_cast<size_t>(d_displaySize.d_width) *
+                         static_cast<size_t>(d_displaySize.d_height));
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
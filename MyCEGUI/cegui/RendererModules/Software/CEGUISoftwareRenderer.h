@@ -0,0 +1,228 @@
+#pragma once
+
+#include "../../CEGUIBase.h"
+#include "../../CEGUIRect.h"
+#include "../../CEGUIRenderer.h"
+#include "../../CEGUISize.h"
+#include "../../CEGUIVector.h"
+#include "../../CEGUIcolour.h"
+#include "../../CEGUIVertexPool.h"
+
+#include <vector>
+
+#if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
+#   ifdef CEGUISOFTWARERENDERER_EXPORTS
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllexport)
+#   else
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllimport)
+#   endif
+#else
+#   define SOFTWARE_GUIRENDERER_API
+#endif
+
+namespace CEGUI
+{
+class SoftwareTexture;
+class SoftwareGeometryBuffer;
+class SoftwareRenderTarget;
+
+/*!
+\brief
+    Renderer class that rasterises all GUI geometry on the CPU into an in
+    memory 32bpp framebuffer.
+
+    The SoftwareRenderer needs no window, device or GPU, which makes it
+    suitable for running the complete GUI pipeline headless (for example on
+    build machines), for frame time benchmarking and for pixel exact
+    comparison of rendered frames in regression tests.
+
+    The framebuffer content of the last rendered frame can be obtained via
+    getFrameBuffer or saveFrameBuffer after System::renderGUI returns.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRenderer : public Renderer
+{
+public:
+    /*!
+    \brief
+        Convenience function that creates the required objects to initialise the
+        CEGUI system.
+
+        This will create and initialise the following objects for you:
+        - CEGUI::SoftwareRenderer
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::System
+
+    \param display_size
+        Size object describing the pixel size of the framebuffer that the
+        renderer is to rasterise into.
+
+    \return
+        Reference to the CEGUI::SoftwareRenderer object that was created.
+    */
+    static SoftwareRenderer& bootstrapSystem(const Size& display_size);
+
+    /*!
+    \brief
+        Convenience function to cleanup the CEGUI system and related objects
+        that were created by calling the bootstrapSystem function.
+
+        This function will destroy the following objects for you:
+        - CEGUI::System
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::SoftwareRenderer
+
+    \note
+        If you did not initialise CEGUI by calling the bootstrapSystem function,
+        you should \e not call this, but rather delete any objects you created
+        manually.
+    */
+    static void destroySystem();
+
+    /*!
+    \brief
+        Create a SoftwareRenderer object.
+
+    \param display_size
+        Size object describing the pixel size of the framebuffer that the
+        renderer is to rasterise into.
+    */
+    static SoftwareRenderer& create(const Size& display_size);
+
+    /*!
+    \brief
+        Destroy a SoftwareRenderer object.
+
+    \param renderer
+        The SoftwareRenderer object to be destroyed.
+    */
+    static void destroy(SoftwareRenderer& renderer);
+
+    /*!
+    \brief
+        Return a pointer to the framebuffer pixels.  The framebuffer holds
+        getDisplaySize().d_width * getDisplaySize().d_height pixels, stored
+        row by row from the top, with each pixel as a 32 bit ARGB value.
+    */
+    const argb_t* getFrameBuffer() const;
+
+    /*!
+    \brief
+        Save / dump the content of the framebuffer to a memory buffer.  The
+        dumped pixel format is always RGBA (4 bytes per pixel), the same as
+        used by Texture::saveToMemory.
+
+    \param buffer
+        Pointer to the buffer that is to receive the image data.  You must make
+        sure that this buffer is large enough to hold the dumped framebuffer.
+    */
+    void saveFrameBuffer(void* buffer) const;
+
+    /*!
+    \brief
+        Set the colour that the framebuffer is cleared to at the start of each
+        frame by beginRendering.  The default is transparent black.
+    */
+    void setClearColour(const colour& col);
+
+    //! Return the colour that the framebuffer is cleared to.
+    const colour& getClearColour() const;
+
+    //! set the SoftwareRenderTarget that subsequent geometry is drawn to.
+    void setActiveRenderTarget(SoftwareRenderTarget* target);
+
+    //! return the SoftwareRenderTarget that geometry is currently drawn to.
+    SoftwareRenderTarget* getActiveRenderTarget() const;
+
+    /*!
+    \brief
+        return the store where geometry buffers keep the projected target
+        surface position (x, y pairs) of their vertices between frames.
+    */
+    float* getProjectedVertexStore();
+
+    //! return the VertexPool that manages space in the projected vertex store.
+    VertexPool& getVertexPool();
+
+    /*!
+    \brief
+        return the areas of the framebuffer being redrawn in the current
+        frame, or 0 if the whole framebuffer is being redrawn.
+    */
+    const std::vector<Rect>* getRedrawRegion() const;
+
+    // implement Renderer interface
+    RenderingRoot& getDefaultRenderingRoot();
+    GeometryBuffer& createGeometryBuffer();
+    void destroyGeometryBuffer(const GeometryBuffer& buffer);
+    void destroyAllGeometryBuffers();
+    TextureTarget* createTextureTarget();
+    void destroyTextureTarget(TextureTarget* target);
+    void destroyAllTextureTargets();
+    Texture& createTexture();
+    Texture& createTexture(const String& filename, const String& resourceGroup);
+    Texture& createTexture(const Size& size);
+    void destroyTexture(Texture& texture);
+    void destroyAllTextures();
+    void beginRendering();
+    void endRendering();
+    bool setRedrawRegion(const Rect* areas, uint area_count);
+    bool supportsRedrawRegion() const;
+    void setDisplaySize(const Size& sz);
+    const Size& getDisplaySize() const;
+    const Vector2& getDisplayDPI() const;
+    uint getMaxTextureSize() const;
+    const String& getIdentifierString() const;
+
+private:
+    //! Constructor for Software Renderer objects.
+    SoftwareRenderer(const Size& display_size);
+
+    //! Destructor for SoftwareRenderer objects.
+    virtual ~SoftwareRenderer();
+
+    //! resize the framebuffer to match d_displaySize.
+    void resizeFrameBuffer();
+
+    //! String holding the renderer identification text.
+    static String d_rendererID;
+    //! What the renderer considers to be the current display size.
+    Size d_displaySize;
+    //! What the renderer considers to be the current display DPI resolution.
+    Vector2 d_displayDPI;
+    //! The default rendering root object
+    RenderingRoot* d_defaultRoot;
+    //! The default RenderTarget (used by d_defaultRoot)
+    RenderTarget* d_defaultTarget;
+    //! container type used to hold TextureTargets we create.
+    typedef std::vector<TextureTarget*> TextureTargetList;
+    //! Container used to track texture targets.
+    TextureTargetList d_textureTargets;
+    //! container type used to hold GeometryBuffers we create.
+    typedef std::vector<SoftwareGeometryBuffer*> GeometryBufferList;
+    //! Container used to track geometry buffers.
+    GeometryBufferList d_geometryBuffers;
+    //! container type used to hold Textures we create.
+    typedef std::vector<SoftwareTexture*> TextureList;
+    //! Container used to track textures.
+    TextureList d_textures;
+    //! type of container used for the framebuffer pixels.
+    typedef std::vector<argb_t> PixelBuffer;
+    //! The framebuffer that the default target rasterises into.
+    PixelBuffer d_frameBuffer;
+    //! colour used to clear the framebuffer in beginRendering.
+    colour d_clearColour;
+    //! RenderTarget that is currently active.
+    SoftwareRenderTarget* d_activeTarget;
+    //! projected vertex positions shared by all geometry buffers.
+    std::vector<float> d_projectedVertices;
+    //! allocator for space in d_projectedVertices.
+    VertexPool d_vertexPool;
+    //! areas of the framebuffer redrawn in the current frame.
+    std::vector<Rect> d_redrawRegion;
+    //! true if only d_redrawRegion is redrawn in the current frame.
+    bool d_redrawRegionActive;
+
+    friend class SoftwareViewportTarget;
+};
+
+}
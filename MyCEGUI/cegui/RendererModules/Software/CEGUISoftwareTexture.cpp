@@ -0,0 +1,208 @@
+#include "CEGUISoftwareTexture.h"
+#include "CEGUIExceptions.h"
+#include "CEGUISystem.h"
+#include "CEGUIImageCodec.h"
+
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture() :
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& filename,
+                                 const String& resourceGroup) :
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0)
+{
+    loadFromFile(filename, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const Size& sz) :
+    d_size(0, 0),
+    d_dataSize(sz),
+    d_texelScaling(0, 0)
+{
+    setTextureSize(sz);
+    clear(0);
+    updateCachedScaleValues();
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::~SoftwareTexture()
+{
+}
+
+//----------------------------------------------------------------------------//
+const argb_t* SoftwareTexture::getPixels() const
+{
+    return d_pixels.empty() ? 0 : &d_pixels[0];
+}
+
+//----------------------------------------------------------------------------//
+argb_t* SoftwareTexture::getPixels()
+{
+    return d_pixels.empty() ? 0 : &d_pixels[0];
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::setTextureSize(const Size& sz)
+{
+    d_size.d_width  = static_cast<float>(static_cast<uint>(sz.d_width));
+    d_size.d_height = static_cast<float>(static_cast<uint>(sz.d_height));
+
+    d_pixels.resize(static_cast<size_t>(d_size.d_width) *
+                    static_cast<size_t>(d_size.d_height));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::clear(argb_t value)
+{
+    std::fill(d_pixels.begin(), d_pixels.end(), value);
+}
+
+//----------------------------------------------------------------------------//
+const Size& SoftwareTexture::getSize() const
+{
+    return d_size;
+}
+
+//----------------------------------------------------------------------------//
+const Size& SoftwareTexture::getOriginalDataSize() const
+{
+    return d_dataSize;
+}
+
+//----------------------------------------------------------------------------//
+const Vector2& SoftwareTexture::getTexelScaling() const
+{
+    return d_texelScaling;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromFile(const String& filename,
+                                   const String& resourceGroup)
+{
+    // get and check existence of CEGUI::System object
+    System* sys = System::getSingletonPtr();
+    if (!sys)
+        CEGUI_THROW(RendererException("SoftwareTexture::loadFromFile - "
+            "CEGUI::System object has not been created!"));
+
+    // load file to memory via resource provider
+    RawDataContainer texFile;
+    sys->getResourceProvider()->loadRawDataContainer(filename, texFile,
+            resourceGroup);
+
+    Texture* res = sys->getImageCodec().load(texFile, this);
+
+    // unload file data buffer
+    sys->getResourceProvider()->unloadRawDataContainer(texFile);
+
+    if (!res)
+        // It's an error
+        CEGUI_THROW(RendererException("SoftwareTexture::loadFromFile - " +
+            sys->getImageCodec().getIdentifierString() +
+            " failed to load image '" + filename + "'."));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromMemory(const void* buffer,
+                                     const Size& buffer_size,
+                                     PixelFormat pixel_format)
+{
+    if (pixel_format != PF_RGB && pixel_format != PF_RGBA)
+        CEGUI_THROW(RendererException("SoftwareTexture::loadFromMemory failed: "
+            "Invalid PixelFormat value specified."));
+
+    setTextureSize(buffer_size);
+    d_dataSize = d_size;
+    updateCachedScaleValues();
+
+    const size_t pixel_count = d_pixels.size();
+    const uchar* src = static_cast<const uchar*>(buffer);
+    argb_t* dst = getPixels();
+
+    // RGBA
+    if (pixel_format == PF_RGBA)
+    {
+        for (size_t i = 0; i < pixel_count; ++i, src += 4)
+            dst[i] = (static_cast<argb_t>(src[3]) << 24) |
+                     (static_cast<argb_t>(src[0]) << 16) |
+                     (static_cast<argb_t>(src[1]) << 8) |
+                      static_cast<argb_t>(src[2]);
+    }
+    // RGB
+    else
+    {
+        for (size_t i = 0; i < pixel_count; ++i, src += 3)
+            dst[i] = 0xFF000000 |
+                     (static_cast<argb_t>(src[0]) << 16) |
+                     (static_cast<argb_t>(src[1]) << 8) |
+                      static_cast<argb_t>(src[2]);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::saveToMemory(void* buffer)
+{
+    const size_t pixel_count = d_pixels.size();
+    uchar* dst = static_cast<uchar*>(buffer);
+
+    for (size_t i = 0; i < pixel_count; ++i, dst += 4)
+    {
+        const argb_t p = d_pixels[i];
+        dst[0] = static_cast<uchar>((p >> 16) & 0xFF);
+        dst[1] = static_cast<uchar>((p >> 8) & 0xFF);
+        dst[2] = static_cast<uchar>(p & 0xFF);
+        dst[3] = static_cast<uchar>((p >> 24) & 0xFF);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::updateCachedScaleValues()
+{
+    //
+    // calculate what to use for x scale
+    //
+    const float orgW = d_dataSize.d_width;
+    const float texW = d_size.d_width;
+
+    // if texture and original data width are the same, scale is based
+    // on the original size.
+    // if texture is wider (and source data was not stretched), scale
+    // is based on the size of the resulting texture.
+    d_texelScaling.d_x = 1.0f / ((orgW == texW) ? orgW : texW);
+
+    //
+    // calculate what to use for y scale
+    //
+    const float orgH = d_dataSize.d_height;
+    const float texH = d_size.d_height;
+
+    // if texture and original data height are the same, scale is based
+    // on the original size.
+    // if texture is taller (and source data was not stretched), scale
+    // is based on the size of the resulting texture.
+    d_texelScaling.d_y = 1.0f / ((orgH == texH) ? orgH : texH);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::setOriginalDataSize(const Size& sz)
+{
+    d_dataSize = sz;
+    updateCachedScaleValues();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
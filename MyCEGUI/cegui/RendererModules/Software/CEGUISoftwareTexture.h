@@ -0,0 +1,87 @@
+#pragma once
+
+#include "../../CEGUIBase.h"
+#include "../../CEGUIRenderer.h"
+#include "../../CEGUITexture.h"
+#include "CEGUISoftwareRenderer.h"
+
+#include <vector>
+
+namespace CEGUI
+{
+/*!
+\brief
+    Texture implementation for the SoftwareRenderer.
+
+    Pixel data is held in system memory as 32 bit ARGB values, with no padding
+    between rows; so the pitch of the pixel data is always the texture width.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareTexture : public Texture
+{
+public:
+    //! Return pointer to the ARGB pixel data held by this texture.
+    const argb_t* getPixels() const;
+
+    //! Return writable pointer to the ARGB pixel data held by this texture.
+    argb_t* getPixels();
+
+    /*!
+    \brief
+        Resize the texture memory to the given size.  The content of the
+        texture is undefined afterwards.  This is used by texture targets.
+    */
+    void setTextureSize(const Size& sz);
+
+    /*!
+    \brief
+        Sets what the texture should consider as the original data size.
+
+    \note
+        This also causes the texel scaling values to be updated.
+    */
+    void setOriginalDataSize(const Size& sz);
+
+    //! Set every pixel in the texture to the given ARGB value.
+    void clear(argb_t value);
+
+    // implement abstract members from base class.
+    const Size& getSize() const;
+    const Size& getOriginalDataSize() const;
+    const Vector2& getTexelScaling() const;
+    void loadFromFile(const String& filename, const String& resourceGroup);
+    void loadFromMemory(const void* buffer, const Size& buffer_size,
+                        PixelFormat pixel_format);
+    void saveToMemory(void* buffer);
+
+protected:
+    // Friends (to allow construction and destruction)
+    friend Texture& SoftwareRenderer::createTexture(void);
+    friend Texture& SoftwareRenderer::createTexture(const String&, const String&);
+    friend Texture& SoftwareRenderer::createTexture(const Size&);
+    friend void SoftwareRenderer::destroyTexture(Texture&);
+
+    //! Basic constructor.
+    SoftwareTexture();
+    //! Construct texture from an image file.
+    SoftwareTexture(const String& filename, const String& resourceGroup);
+    //! Construct texture with a given size.
+    SoftwareTexture(const Size& sz);
+    //! Destructor.
+    virtual ~SoftwareTexture();
+
+    //! updates cached scale value used to map pixels to texture co-ords.
+    void updateCachedScaleValues();
+
+    //! type of container used to hold the pixels.
+    typedef std::vector<argb_t> PixelBuffer;
+    //! The pixel data.
+    PixelBuffer d_pixels;
+    //! Size of the texture.
+    Size d_size;
+    //! original pixel of size data loaded into texture
+    Size d_dataSize;
+    //! cached pixel to texel mapping scale values.
+    Vector2 d_texelScaling;
+};
+
+}
@@ -0,0 +1,90 @@
+#include "CEGUISoftwareTextureTarget.h"
+#include "CEGUISoftwareTexture.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const float SoftwareTextureTarget::DEFAULT_SIZE = 128.0f;
+
+//----------------------------------------------------------------------------//
+SoftwareTextureTarget::SoftwareTextureTarget(SoftwareRenderer& owner) :
+    SoftwareRenderTarget(owner)
+{
+    // this essentially creates a 'null' CEGUI::Texture
+    d_texture = &static_cast<SoftwareTexture&>(d_owner.createTexture());
+
+    // setup area and cause the initial texture to be generated.
+    declareRenderSize(Size(DEFAULT_SIZE, DEFAULT_SIZE));
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTextureTarget::~SoftwareTextureTarget()
+{
+    d_owner.destroyTexture(*d_texture);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTextureTarget::declareRenderSize(const Size& sz)
+{
+    // exit if current size is enough
+    if ((d_area.getWidth() >= sz.d_width) && (d_area.getHeight() >=sz.d_height))
+        return;
+
+    setArea(Rect(d_area.getPosition(), sz));
+    resizeRenderTexture();
+    clear();
+}
+
+//----------------------------------------------------------------------------//
+argb_t* SoftwareTextureTarget::getPixelBuffer()
+{
+    return d_texture->getPixels();
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareTextureTarget::getPixelBufferWidth() const
+{
+    return static_cast<uint>(d_texture->getSize().d_width);
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareTextureTarget::getPixelBufferHeight() const
+{
+    return static_cast<uint>(d_texture->getSize().d_height);
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTextureTarget::isImageryCache() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTextureTarget::clear()
+{
+    d_texture->clear(0);
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareTextureTarget::getTexture() const
+{
+    return *d_texture;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTextureTarget::resizeRenderTexture()
+{
+    d_texture->setTextureSize(d_area.getSize());
+    d_texture->setOriginalDataSize(d_area.getSize());
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTextureTarget::isRenderingInverted() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
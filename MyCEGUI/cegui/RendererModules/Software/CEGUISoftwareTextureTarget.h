@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CEGUISoftwareRenderTarget.h"
+#include "../../CEGUITextureTarget.h"
+#include "../../CEGUIRect.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4250)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class SoftwareTexture;
+
+//! SoftwareTextureTarget - allows rendering into a SoftwareTexture.
+class SOFTWARE_GUIRENDERER_API SoftwareTextureTarget : public SoftwareRenderTarget,
+                                                       public TextureTarget
+{
+public:
+    SoftwareTextureTarget(SoftwareRenderer& owner);
+    virtual ~SoftwareTextureTarget();
+
+    // implementations of SoftwareRenderTarget interface
+    argb_t* getPixelBuffer();
+    uint getPixelBufferWidth() const;
+    uint getPixelBufferHeight() const;
+    // implementation of RenderTarget interface
+    bool isImageryCache() const;
+    // implementation of TextureTarget interface
+    void clear();
+    Texture& getTexture() const;
+    void declareRenderSize(const Size& sz);
+    bool isRenderingInverted() const;
+
+protected:
+    //! default size of created texture objects
+    static const float DEFAULT_SIZE;
+
+    //! resize the texture
+    void resizeRenderTexture();
+
+    //! the texture that's rendered to.
+    SoftwareTexture* d_texture;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
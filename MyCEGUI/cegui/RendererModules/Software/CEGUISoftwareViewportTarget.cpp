@@ -0,0 +1,47 @@
+#include "CEGUISoftwareViewportTarget.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+SoftwareViewportTarget::SoftwareViewportTarget(SoftwareRenderer& owner) :
+    SoftwareRenderTarget(owner)
+{
+    setArea(Rect(Point(0, 0), d_owner.getDisplaySize()));
+}
+
+//----------------------------------------------------------------------------//
+SoftwareViewportTarget::SoftwareViewportTarget(SoftwareRenderer& owner,
+    const Rect& area) :
+        SoftwareRenderTarget(owner)
+{
+    setArea(area);
+}
+
+//----------------------------------------------------------------------------//
+argb_t* SoftwareViewportTarget::getPixelBuffer()
+{
+    return d_owner.d_frameBuffer.empty() ? 0 : &d_owner.d_frameBuffer[0];
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareViewportTarget::getPixelBufferWidth() const
+{
+    return static_cast<uint>(d_owner.getDisplaySize().d_width);
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareViewportTarget::getPixelBufferHeight() const
+{
+    return static_cast<uint>(d_owner.getDisplaySize().d_height);
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareViewportTarget::isImageryCache() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
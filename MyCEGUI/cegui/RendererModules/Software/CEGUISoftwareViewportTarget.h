@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CEGUISoftwareRenderTarget.h"
+#include "../../CEGUIRect.h"
+
+namespace CEGUI
+{
+/*!
+\brief
+    Software RenderTarget that represents the renderer's framebuffer.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareViewportTarget :
+    public SoftwareRenderTarget
+{
+public:
+    /*!
+    \brief
+        Construct a default SoftwareViewportTarget that uses the entire
+        framebuffer of \a owner as it's initial area.
+    */
+    SoftwareViewportTarget(SoftwareRenderer& owner);
+
+    /*!
+    \brief
+        Construct a SoftwareViewportTarget that uses the specified Rect as it's
+        initial area.
+
+    \param area
+        Rect object describing the initial viewport area that should be used for
+        the RenderTarget.
+    */
+    SoftwareViewportTarget(SoftwareRenderer& owner, const Rect& area);
+
+    // implementations of SoftwareRenderTarget interface
+    argb_t* getPixelBuffer();
+    uint getPixelBufferWidth() const;
+    uint getPixelBufferHeight() const;
+    // implementations of RenderTarget interface
+    bool isImageryCache() const;
+};
+
+}